@@ -0,0 +1,660 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/* 
+ * File:   main.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 3:24 PM
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <iostream>
+#include <iomanip>
+#include <queue>
+#include <vector>
+#include <memory>
+#include <random>
+#include <chrono>
+#include <string>
+#include <functional>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <boost/make_unique.hpp>
+
+#include "../include/Calls/Event.h"
+#include "../include/Calls/EventQueue.h"
+#include "../include/Calls/EventGenerator.h"
+#include "../include/Calls/Call.h"
+#include "../include/Calls/Traffic.h"
+#include "../include/SimulationType/SimulationMultiLoad.h"
+#include "../include/Kernel.h"
+#include "../include/Data/Parameters.h"
+#include "../include/Data/Options.h"
+#include "../include/Data/Data.h"
+#include "../include/Data/InputOutput.h"
+#include "../include/Structure/Topology.h"
+#include "../include/ResourceAllocation/ResourceAlloc.h"
+#include "../include/ResourceAllocation/Resources.h"
+#include "../include/ResourceAllocation/Routing.h"
+#include "../include/ResourceAllocation/Modulation.h"
+#include "../include/ResourceAllocation/SA.h"
+#include "../include/ResourceAllocation/CSA.h"
+
+/**
+ * @brief Structure to compare the events time in the std::priority_queue 
+ * used as reference.
+ */
+struct EventCompare {
+    bool operator()(const std::shared_ptr<Event>& eventA,
+                    const std::shared_ptr<Event>& eventB) const {
+        return eventA->GetEventTime() > eventB->GetEventTime();
+    }
+};
+
+/**
+ * @brief Hold model with the previous event queue: a std::priority_queue of
+ * events allocated with std::make_shared.
+ * @param queueSize Number of events kept in the queue.
+ * @param numEvents Number of events processed.
+ * @param sumTimes Sum of the times of the processed events.
+ * @return Number of processed events per second.
+ */
+double PriorityQueueHold(unsigned int queueSize, unsigned int numEvents,
+                         TIME& sumTimes) {
+    std::mt19937 engine(0);
+    std::exponential_distribution<TIME> distribution(1.0);
+    std::priority_queue<std::shared_ptr<Event>, 
+                        std::vector<std::shared_ptr<Event>>, 
+                        EventCompare> queueEvents;
+    std::shared_ptr<Event> evt;
+    TIME actualTime = 0.0;
+    
+    for(unsigned int a = 0; a < queueSize; a++)
+        queueEvents.push(std::make_shared<Event>(nullptr, nullptr, 
+                                                 distribution(engine)));
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for(unsigned int a = 0; a < numEvents; a++){
+        evt = queueEvents.top();
+        queueEvents.pop();
+        actualTime = evt->GetEventTime();
+        sumTimes += actualTime;
+        queueEvents.push(std::make_shared<Event>(nullptr, nullptr, 
+                         actualTime + distribution(engine)));
+    }
+    
+    std::chrono::duration<double> elapsed = 
+    std::chrono::steady_clock::now() - start;
+    
+    return numEvents / elapsed.count();
+}
+
+/**
+ * @brief Hold model with the EventQueue, where the processed events are 
+ * released to the pool and reused.
+ * @param queueSize Number of events kept in the queue.
+ * @param numEvents Number of events processed.
+ * @param sumTimes Sum of the times of the processed events.
+ * @return Number of processed events per second.
+ */
+double EventQueueHold(unsigned int queueSize, unsigned int numEvents,
+                      TIME& sumTimes) {
+    std::mt19937 engine(0);
+    std::exponential_distribution<TIME> distribution(1.0);
+    EventQueue queueEvents;
+    Event* evt;
+    TIME actualTime = 0.0;
+    
+    for(unsigned int a = 0; a < queueSize; a++)
+        queueEvents.Push(queueEvents.CreateEvent(nullptr, nullptr, 
+                                                 distribution(engine)));
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for(unsigned int a = 0; a < numEvents; a++){
+        evt = queueEvents.Pop();
+        actualTime = evt->GetEventTime();
+        sumTimes += actualTime;
+        queueEvents.ReleaseEvent(evt);
+        queueEvents.Push(queueEvents.CreateEvent(nullptr, nullptr, 
+                         actualTime + distribution(engine)));
+    }
+    
+    std::chrono::duration<double> elapsed = 
+    std::chrono::steady_clock::now() - start;
+    
+    return numEvents / elapsed.count();
+}
+
+
+//Index of the benchmark simulations. Their outputs are opened in 
+//Files/Outputs/0, so the outputs of the numbered simulations are kept.
+const SimulIndex benchIndex = 0;
+//Number of call requests created to load the network of the micro 
+//benchmarks, and number of calls used in each measurement.
+const unsigned int numLoadCalls = 100000;
+const unsigned int numTestCalls = 1000;
+
+/**
+ * @brief Settings of a fixed benchmark scenario. The other settings are the
+ * same for all scenarios: EON with 128 slots, RSA with YEN (k = 3) and 
+ * length costs, without the physical layer, and the 100-200-400 traffic.
+ */
+struct BenchScenario {
+    std::string name;
+    TopologyOption topology;
+    SpectrumAllocationOption specAlloc;
+    unsigned int numCores;
+    double load;
+};
+
+const std::vector<BenchScenario> macroScenarios = {
+    {"NSFNet", TopologyNSFNet, SpecAllFF, 1, 150.0},
+    {"US_Backbone", TopologyUS_Backbone, SpecAllFF, 1, 180.0},
+    {"European", TopologyEuropean, SpecAllFF, 1, 150.0}
+};
+
+const BenchScenario microScenario = 
+{"NSFNet", TopologyNSFNet, SpecAllMSCL, 1, 60.0};
+const BenchScenario microScenarioCores = 
+{"NSFNet 7 cores", TopologyNSFNet, SpecAllMSCL, 7, 60.0};
+
+/**
+ * @brief Simulation of a benchmark scenario. It is created as a copy of a 
+ * simulation with the scenario settings, like the copies of the parallel 
+ * execution, so only the topology and traffic files of Files/Inputs are 
+ * read and the results do not depend on the options and parameters files.
+ */
+class BenchSimulation {
+public:
+    /**
+     * @brief Standard constructor of a BenchSimulation object.
+     * @param scenario Benchmark scenario.
+     * @param numRequests Number of call requests of a run.
+     */
+    BenchSimulation(const BenchScenario& scenario, double numRequests)
+    :origin(benchIndex, MultiLoadSimulationType), simul(nullptr) {
+        Parameters* parameters = origin.GetParameters();
+        Options* options = origin.GetOptions();
+        
+        parameters->SetNumberSlots(128);
+        parameters->SetNumberCores(scenario.numCores);
+        parameters->SetMu(1.0);
+        parameters->SetMinLoadPoint(scenario.load);
+        parameters->SetMaxLoadPoint(scenario.load);
+        parameters->SetNumberLoadPoints(1);
+        parameters->SetLoadPoint(std::vector<double>{scenario.load});
+        parameters->SetNumberReqMax(numRequests);
+        parameters->SetNumberBloqMax(numRequests);
+        parameters->SetNumberRoutes(3);
+        parameters->SetMaxSectionLegnth(80.0);
+        parameters->SetNumberPolarizations(2);
+        parameters->SetGuardBand(0);
+        
+        options->SetTopologyOption(scenario.topology);
+        options->SetRoutingOption(RoutingYEN);
+        options->SetSpecAllOption(scenario.specAlloc);
+        options->SetLinkCostType(LinkCostLength);
+        options->SetTrafficOption(Traffic_100_200_400);
+        options->SetResourAllocOption(ResourAllocRSA);
+        options->SetPhyLayerOption(PhyLayerDisabled);
+        options->SetNetworkOption(NetworkEON);
+        origin.GetTraffic()->LoadFile();
+        
+        simul = boost::make_unique<SimulationMultiLoad>(origin);
+        simul->LoadCopy();
+        simul->GetData()->SetActualIndex(0);
+        simul->GetCallGenerator()->SetNetworkLoad(scenario.load);
+    }
+    
+    /**
+     * @brief Function to get the simulation of the scenario.
+     * @return Simulation ready to run.
+     */
+    SimulationMultiLoad* Get() const {
+        return simul.get();
+    }
+private:
+    /**
+     * @brief Simulation that keeps the settings shared with the copy.
+     */
+    SimulationMultiLoad origin;
+    /**
+     * @brief Simulation of the scenario.
+     */
+    std::unique_ptr<SimulationMultiLoad> simul;
+};
+
+/**
+ * @brief Function to create the output folders of the benchmark 
+ * simulations.
+ * @return True if the folders exist.
+ */
+bool CreateOutputFolders() {
+    std::string folder = "Files/Outputs/" + std::to_string(benchIndex);
+    
+    for(auto const& it: {folder, folder + "/GA", folder + "/PSO"}){
+        
+        if(mkdir(it.c_str(), 0755) != 0 && errno != EEXIST){
+            std::cerr << "Unable to create the folder " << it 
+                      << ", run the benchmarks from the folder with the "
+                      << "Files folder" << std::endl;
+            return false;
+        }
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Function to get the peak resident set size of the process.
+ * @return Peak resident set size, in MB.
+ */
+double GetPeakRSS() {
+    struct rusage usage;
+    
+    getrusage(RUSAGE_SELF, &usage);
+    
+    return usage.ru_maxrss / 1024.0;
+}
+
+/**
+ * @brief Function to measure the mean time of an operation.
+ * @param numOperations Number of operations done by the function.
+ * @param function Function that does the operations.
+ * @return Time per operation, in nanoseconds.
+ */
+double MeasureOperation(double numOperations, 
+                        const std::function<void()>& function) {
+    auto start = std::chrono::steady_clock::now();
+    
+    function();
+    
+    std::chrono::duration<double, std::nano> elapsed = 
+    std::chrono::steady_clock::now() - start;
+    
+    return elapsed.count() / numOperations;
+}
+
+/**
+ * @brief Function to print the result of a micro-benchmark.
+ * @param name Name of the benchmark.
+ * @param numOperations Number of operations measured.
+ * @param time Time per operation, in nanoseconds.
+ * @param checksum Sum of the results of the operations.
+ */
+void PrintMicro(const std::string& name, double numOperations, double time,
+                double checksum) {
+    std::cout << std::left << std::setw(34) << name << std::right 
+              << std::setw(12) << std::setprecision(0) << std::fixed 
+              << numOperations << std::setw(14) << std::setprecision(1) 
+              << time << std::setw(20) << std::defaultfloat 
+              << std::setprecision(12) << checksum << std::endl;
+}
+
+/**
+ * @brief Function to create call requests with fixed seed node pairs and 
+ * bit rates.
+ * @param simul Simulation of the calls.
+ * @param numCalls Number of calls.
+ * @param seed Seed of the node pairs and bit rates.
+ * @return Container of calls.
+ */
+std::vector<std::shared_ptr<Call>> CreateCalls(SimulationType* simul,
+unsigned int numCalls, unsigned int seed) {
+    std::mt19937 engine(seed);
+    Topology* topology = simul->GetTopology();
+    std::vector<double> vecTraffic = simul->GetTraffic()->GetVecTraffic();
+    std::uniform_int_distribution<unsigned int> nodeDistribution(0, 
+    topology->GetNumNodes() - 1);
+    std::uniform_int_distribution<unsigned int> trafficDistribution(0,
+    vecTraffic.size() - 1);
+    std::vector<std::shared_ptr<Call>> calls;
+    unsigned int orNode, deNode;
+    
+    for(unsigned int a = 0; a < numCalls; a++){
+        orNode = nodeDistribution(engine);
+        
+        do{
+            deNode = nodeDistribution(engine);
+        }while(orNode == deNode);
+        
+        calls.push_back(std::make_shared<Call>(topology->GetNode(orNode),
+        topology->GetNode(deNode), vecTraffic.at(trafficDistribution(engine)),
+        0.0));
+    }
+    
+    return calls;
+}
+
+/**
+ * @brief Function to load the network with calls allocated by the resource 
+ * allocation of the simulation, until the first blocked call.
+ * @param simul Simulation of the calls.
+ * @return Container of calls in progress.
+ */
+std::vector<std::shared_ptr<Call>> LoadNetwork(SimulationType* simul) {
+    ResourceAlloc* resourceAlloc = simul->GetResourceAlloc();
+    std::vector<std::shared_ptr<Call>> activeCalls;
+    
+    for(auto& call: CreateCalls(simul, numLoadCalls, 1)){
+        resourceAlloc->ResourAlloc(call.get());
+        
+        if(call->GetStatus() != Accepted)
+            break;
+        simul->GetTopology()->Connect(call.get());
+        activeCalls.push_back(call);
+    }
+    
+    return activeCalls;
+}
+
+/**
+ * @brief Function to create the calls of the measurements, with the first 
+ * route of their node pairs and the fixed modulation format of the RSA.
+ * @param simul Simulation of the calls.
+ * @return Container of calls.
+ */
+std::vector<std::shared_ptr<Call>> CreateTestCalls(SimulationType* simul) {
+    ResourceAlloc* resourceAlloc = simul->GetResourceAlloc();
+    Resources* resources = resourceAlloc->GetResources();
+    std::vector<std::shared_ptr<Call>> calls = CreateCalls(simul, 
+                                               numTestCalls, 2);
+    
+    for(auto& call: calls){
+        call->SetRoute(resources->GetRoutes(call->GetOrNode()->GetNodeId(),
+                       call->GetDeNode()->GetNodeId()).front());
+        call->SetModulation(FixedModulation);
+        call->SetCore(0);
+        resourceAlloc->modulation->SetModulationParam(call.get());
+    }
+    
+    return calls;
+}
+
+/**
+ * @brief Micro-benchmarks of the simulation hot path. The functions are 
+ * measured in a network loaded until the first blocked call. In the 
+ * checksums of the spectrum allocations, a call without free slots counts
+ * as the number of slots.
+ * @param numRepetitions Number of repetitions of each measurement.
+ */
+void MicroBenchmarks(unsigned int numRepetitions) {
+    BenchSimulation bench(microScenario, 1.0);
+    SimulationType* simul = bench.Get();
+    ResourceAlloc* resourceAlloc = simul->GetResourceAlloc();
+    Topology* topology = simul->GetTopology();
+    unsigned int numNodes = topology->GetNumNodes();
+    unsigned int numSlots = topology->GetNumSlots();
+    std::vector<std::shared_ptr<Call>> activeCalls = LoadNetwork(simul);
+    std::vector<std::shared_ptr<Call>> calls = CreateTestCalls(simul);
+    double numOperations, time, checksum;
+    TIME sumTimes;
+    
+    std::cout << "MICRO-BENCHMARKS (" << microScenario.name << ", " 
+              << activeCalls.size() << " calls in progress, " 
+              << numRepetitions << " repetitions)" << std::endl;
+    std::cout << std::left << std::setw(34) << "Benchmark" << std::right
+              << std::setw(12) << "Operations" << std::setw(14) << "ns/op" 
+              << std::setw(20) << "Checksum" << std::endl;
+    
+    numOperations = checksum = 0.0;
+    for(auto& call: calls)
+        numOperations += numSlots - call->GetNumberSlots() + 1;
+    numOperations *= numRepetitions;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                for(SlotIndex s = 0; s + call->GetNumberSlots() <= numSlots;
+                s++)
+                    checksum += resourceAlloc->CheckSlotsDisp(
+                    call->GetRoute(), s, s + call->GetNumberSlots() - 1);
+            }
+        }
+    });
+    PrintMicro("ResourceAlloc::CheckSlotsDisp", numOperations, time, 
+               checksum);
+    
+    numOperations = (double) numRepetitions * calls.size();
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                resourceAlloc->modulation->SetModulationParam(call.get());
+                checksum += call->GetNumberSlots();
+            }
+        }
+    });
+    PrintMicro("Modulation::SetModulationParam", numOperations, time, 
+               checksum);
+    
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                resourceAlloc->specAlloc->SA::FirstFit(call.get());
+                checksum += std::min(call->GetFirstSlot(), numSlots);
+            }
+        }
+    });
+    PrintMicro("SA::FirstFit", numOperations, time, checksum);
+    
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                resourceAlloc->specAlloc->SA::MSCL(call.get());
+                checksum += std::min(call->GetFirstSlot(), numSlots);
+            }
+        }
+    });
+    PrintMicro("SA::MSCL", numOperations, time, checksum);
+    
+    numOperations = numRepetitions;
+    checksum = 0.0;
+    simul->GetOptions()->SetFragMeasureOption(FragMetricEF);
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++)
+            checksum += resourceAlloc->CalcNetworkFragmentation();
+    });
+    PrintMicro("CalcNetworkFragmentation (EF)", numOperations, time, 
+               checksum);
+    
+    numOperations = (double) numRepetitions * numNodes * (numNodes - 1);
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(NodeIndex orN = 0; orN < numNodes; orN++){
+                for(NodeIndex deN = 0; deN < numNodes; deN++){
+                    if(orN != deN)
+                        checksum += resourceAlloc->routing->YEN(orN, deN)
+                                    .size();
+                }
+            }
+        }
+    });
+    PrintMicro("Routing::YEN", numOperations, time, checksum);
+    
+    numOperations = (double) numRepetitions * calls.size();
+    sumTimes = 0.0;
+    time = 1E9 / EventQueueHold(10000, numOperations, sumTimes);
+    PrintMicro("EventQueue push/pop (10000)", numOperations, time, 
+               sumTimes);
+    
+    BenchSimulation benchCores(microScenarioCores, 1.0);
+    simul = benchCores.Get();
+    resourceAlloc = simul->GetResourceAlloc();
+    activeCalls = LoadNetwork(simul);
+    calls = CreateTestCalls(simul);
+    
+    numOperations = (double) numRepetitions * calls.size();
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                resourceAlloc->specAlloc->FirstFit(call.get());
+                checksum += std::min(call->GetFirstSlot(), numSlots) + 
+                            call->GetCore();
+            }
+        }
+    });
+    PrintMicro("CSA::FirstFit (" + std::to_string(activeCalls.size()) + 
+               " calls)", numOperations, time, checksum);
+    
+    checksum = 0.0;
+    time = MeasureOperation(numOperations, [&](){
+        for(unsigned int r = 0; r < numRepetitions; r++){
+            for(auto& call: calls){
+                resourceAlloc->specAlloc->MSCL(call.get());
+                checksum += std::min(call->GetFirstSlot(), numSlots) + 
+                            call->GetCore();
+            }
+        }
+    });
+    PrintMicro("CSA::MSCL (" + std::to_string(activeCalls.size()) + 
+               " calls)", numOperations, time, checksum);
+}
+
+/**
+ * @brief Macro-benchmarks of whole runs of the fixed seed scenarios. The 
+ * peak resident set size is the peak of the process until the end of each 
+ * run.
+ * @param numRequests Number of call requests of each run.
+ */
+void MacroBenchmarks(double numRequests) {
+    
+    std::cout << "MACRO-BENCHMARKS (" << numRequests << " requests)" 
+              << std::endl;
+    std::cout << std::left << std::setw(14) << "Scenario" << std::right
+              << std::setw(8) << "Load" << std::setw(12) << "Events" 
+              << std::setw(10) << "Time(s)" << std::setw(14) << "Events/s"
+              << std::setw(12) << "ReqBP" << std::setw(16) 
+              << "Peak RSS(MB)" << std::endl;
+    
+    for(auto const& scenario: macroScenarios){
+        BenchSimulation bench(scenario, numRequests);
+        SimulationMultiLoad* simul = bench.Get();
+        EventGenerator* generator = simul->GetCallGenerator();
+        
+        simul->RunBase();
+        
+        std::cout << std::left << std::setw(14) << scenario.name 
+                  << std::right << std::fixed << std::setprecision(0) 
+                  << std::setw(8) << scenario.load << std::setw(12) 
+                  << generator->GetNumberEvents() << std::setw(10) 
+                  << std::setprecision(2) << generator->
+                  GetRealSimulationTime() << std::setw(14) 
+                  << std::setprecision(0) << generator->GetNumberEvents() /
+                  generator->GetRealSimulationTime() << std::setw(12) 
+                  << std::setprecision(6) << simul->GetData()->GetReqBP() 
+                  << std::setw(16) << std::setprecision(1) << GetPeakRSS() 
+                  << std::endl;
+    }
+}
+
+/**
+ * @brief Micro-benchmark of the simulator event queue. Compares the number 
+ * of events per second of the EventQueue and of the previous 
+ * std::priority_queue, for several queue sizes.
+ * @param numEvents Number of events processed for each queue size.
+ * @return True if both queues processed the same event sequences.
+ */
+bool QueueBenchmarks(unsigned int numEvents) {
+    std::vector<unsigned int> queueSizes = {100, 1000, 10000, 100000};
+    TIME sumTimesRef, sumTimes;
+    double refRate, rate;
+    
+    std::cout << "EVENT QUEUE HOLD BENCHMARK (" << numEvents << " events)" 
+              << std::endl;
+    std::cout << std::setw(12) << "Queue size" << std::setw(24) 
+              << "priority_queue(ev/s)" << std::setw(24) 
+              << "EventQueue(ev/s)" << std::setw(10) << "Speedup" 
+              << std::endl;
+    
+    for(auto size: queueSizes){
+        sumTimesRef = sumTimes = 0.0;
+        refRate = PriorityQueueHold(size, numEvents, sumTimesRef);
+        rate = EventQueueHold(size, numEvents, sumTimes);
+        
+        if(sumTimes != sumTimesRef){
+            std::cerr << "Different event sequences" << std::endl;
+            return false;
+        }
+        
+        std::cout << std::setw(12) << size << std::setw(24) << std::fixed 
+                  << std::setprecision(0) << refRate << std::setw(24) << rate
+                  << std::setw(10) << std::setprecision(2) << rate / refRate 
+                  << std::endl;
+    }
+    
+    return true;
+}
+
+/**
+ * @brief Benchmarks of the simulator, run from the folder that contains the
+ * Files folder. All scenarios have fixed seeds, and the checksums and 
+ * blocking probabilities printed allow to check that an optimization does 
+ * not change the results.
+ * Usage: bench [all|queue|micro|macro] [size]
+ * The size is the number of events of the queue benchmark, the number of 
+ * repetitions of the micro-benchmarks or the number of requests of the 
+ * macro-benchmarks. A number as the first argument runs the queue 
+ * benchmark with this number of events.
+ */
+int main(int argc, char** argv) {
+    std::string suite = "all";
+    unsigned int size = 0;
+    
+    if(argc > 1 && std::isdigit(argv[1][0])){
+        suite = "queue";
+        size = std::stod(argv[1]);
+    }
+    else if(argc > 1){
+        suite = argv[1];
+        
+        if(argc > 2)
+            size = std::stod(argv[2]);
+    }
+    
+    if(suite != "all" && suite != "queue" && suite != "micro" && 
+    suite != "macro"){
+        std::cerr << "Usage: bench [all|queue|micro|macro] [size]" 
+                  << std::endl;
+        return 1;
+    }
+    
+    if(suite == "all" || suite == "queue"){
+        
+        if(!QueueBenchmarks(size ? size : 2000000))
+            return 1;
+        
+        if(suite == "all")
+            std::cout << std::endl;
+    }
+    
+    if(suite == "micro" || suite == "macro" || suite == "all"){
+        InputOutput::SetInteractive(false);
+        
+        if(!CreateOutputFolders())
+            return 1;
+    }
+    
+    if(suite == "all" || suite == "micro"){
+        MicroBenchmarks(size ? size : 100);
+        
+        if(suite == "all")
+            std::cout << std::endl;
+    }
+    
+    if(suite == "all" || suite == "macro")
+        MacroBenchmarks(size ? size : 1E5);
+    
+    return 0;
+}
@@ -22,10 +22,12 @@ class SimulationType;
 #include <random>
 #include <algorithm>
 #include <iostream>
+#include <functional>
 
 #include "Individual.h"
 #include "../../Data/InputOutput.h"
 #include "../../GeneralClasses/Def.h"
+#include "../../GeneralClasses/RandomStreams.h"
 
 /**
  * @brief Generic genetic algorithm class. This class contain the similar 
@@ -179,6 +181,18 @@ public:
      * population, with less simulation than the minimum required.
      */
     virtual void CheckMinSimul() = 0;
+    /**
+     * @brief Apply the genes of a specified individual in a simulation.
+     * @param ind Specified individual.
+     * @param simul Simulation where the genes are applied.
+     */
+    virtual void ApplyIndividual(Individual* ind, SimulationType* simul) = 0;
+    /**
+     * @brief Set the individual parameters found by a simulation.
+     * @param ind Specified individual.
+     * @param simul Simulation that evaluated the individual.
+     */
+    virtual void SetIndParameters(Individual* ind, SimulationType* simul) = 0;
     
     /**
      * @brief Function to print the GA data of the actual generation into a
@@ -193,6 +207,26 @@ public:
      * @return Output stream.
      */
     virtual std::ostream& printParameters(std::ostream& ostream) const;
+protected:
+    /**
+     * @brief Simulates the individuals of a population. Each individual is
+     * simulated while the check function, that receives the individual and 
+     * the number of simulations already done for it in this call, returns 
+     * true. In parallel execution the individuals are dispatched to copies of 
+     * the GA simulation, so the parameters of each individual are set only by
+     * the copy that simulated it.
+     * @param population Population to simulate.
+     * @param checkRun Function that checks if the individual is simulated.
+     */
+    void RunPopulation(const std::vector<std::shared_ptr<Individual>>& 
+    population, const std::function<bool(Individual*, unsigned int)>& 
+    checkRun);
+private:
+    /**
+     * @brief Function to create the copies of the GA simulation used to 
+     * evaluate the individuals in parallel.
+     */
+    void CreateSimulCopies();
 private:
     /**
      * @brief Pointer to a SimulationType object that owns this algorithm.
@@ -231,11 +265,22 @@ private:
      * and mutation.
      */
     std::uniform_real_distribution<double> probDistribution;
+    /**
+     * @brief Copies of the GA simulation, one for each worker thread, used in
+     * parallel execution.
+     */
+    std::vector<std::unique_ptr<SimulationType>> simulCopies;
+    /**
+     * @brief Number of individuals dispatched to the simulation copies. It 
+     * defines the random sequences of each individual with pseudo-random 
+     * generation.
+     */
+    unsigned int numDispatchedInd;
 public:
     /**
-     * @brief Random generator.
+     * @brief Random generator, from the GA stream of the simulation.
      */
-    static std::default_random_engine random_generator;
+    RandomStreams::Engine& random_generator;
 };
 
 #endif /* GA_H */
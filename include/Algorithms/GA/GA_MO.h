@@ -93,16 +93,6 @@ public:
      */
     void SaveIndividuals() override;
 
-    /**
-     * @brief Apply the gene of a specified individual in the network.
-     * @param ind Individual pointer.
-     */
-    virtual void ApplyIndividual(Individual* ind) = 0;
-    /**
-     * @brief Set the individual parameters found by the simulation.
-     * @param ind Specified individual.
-     */
-    virtual void SetIndParameters(Individual* ind) = 0;
     
     /**
      * @brief Runs the simulation for the Pareto fronts of the GA.
@@ -95,13 +95,15 @@ public:
      * @brief Apply the genes of a specified individual in the network.
      * Apply the number of interfering routes to check by MSCL.
      * @param ind Specified individual.
+     * @param simul Simulation where the genes are applied.
      */
-    void ApplyIndividual(Individual* ind) override;
+    void ApplyIndividual(Individual* ind, SimulationType* simul) override;
     /**
      * @brief Set the individual parameters found by the simulation.
      * @param ind Specified individual.
+     * @param simul Simulation that evaluated the individual.
      */
-    void SetIndParameters(Individual* ind) override;
+    void SetIndParameters(Individual* ind, SimulationType* simul) override;
 private:
     /**
      * @brief Function to create new individuals by crossover.
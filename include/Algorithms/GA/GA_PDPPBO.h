@@ -55,13 +55,15 @@ public:
      * @brief Apply the genes of a specified individual in the network.
      * Apply the Bit rate distribution to check by PDPP.
      * @param ind Specified individual.
+     * @param simul Simulation where the genes are applied.
      */
-    void ApplyIndividual(Individual* ind) override;
+    void ApplyIndividual(Individual* ind, SimulationType* simul) override;
     /**
      * @brief Set the individual parameters found by the simulation.
      * @param ind Specified individual.
+     * @param simul Simulation that evaluated the individual.
      */
-    void SetIndParameters(Individual* ind) override;
+    void SetIndParameters(Individual* ind, SimulationType* simul) override;
     
     /**
      * @brief Gets the number of nodes of the network.
@@ -81,14 +81,16 @@ public:
      * @brief Apply the genes of a specified individual in the network RSA 
      * order .
      * @param ind Specified individual.
+     * @param simul Simulation where the genes are applied.
      */
-    void ApplyIndividual(Individual* ind) override;
+    void ApplyIndividual(Individual* ind, SimulationType* simul) override;
     /**
      * @brief Set the individual parameters. For this GA, set the blocking
      * probability found and the fitness.
      * @param ind Specified individual.
+     * @param simul Simulation that evaluated the individual.
      */
-    void SetIndParameters(Individual* ind) override;
+    void SetIndParameters(Individual* ind, SimulationType* simul) override;
     /**
      * @brief Sets the fitness of all individuals in the selected population
      * container.
@@ -114,16 +114,6 @@ public:
      */
     Individual* GetIniIndividual(unsigned int index);
     
-    /**
-     * @brief Apply the gene of a specified individual in the network.
-     * @param ind Individual pointer.
-     */
-    virtual void ApplyIndividual(Individual* ind) = 0;
-    /**
-     * @brief Set the individual parameters found by the simulation.
-     * @param ind Specified individual.
-     */
-    virtual void SetIndParameters(Individual* ind) = 0;
     /**
      * @brief Pick an individual based on the roulette choosing process. 
      * @return Chosen individual.
@@ -21,6 +21,8 @@ class SimulationType;
 class ParticlePSO;
 class Options;
 
+#include "../../GeneralClasses/RandomStreams.h"
+
 class PSO {
     
     friend std::ostream& operator<<(std::ostream& ostream, const PSO* pso);
@@ -150,7 +152,7 @@ private:
     std::vector<std::shared_ptr<ParticlePSO>> bestParticles;
 public:
     
-    static std::default_random_engine random_engine;
+    RandomStreams::Engine& random_engine;
 };
 
 #endif /* PSO_H */
@@ -254,7 +254,8 @@ public:
    * index.
    * @return Call request possible route (vector trialProtRoutes).
    */
-    std::deque<std::shared_ptr<Route>> GetProtRoutes(unsigned int routeIndex);
+    const std::deque<std::shared_ptr<Route>>& GetProtRoutes(
+    unsigned int routeIndex) const;
 
     /**
      * @brief Function to get the number of routes the call can be allocated.
@@ -283,13 +284,14 @@ public:
      * call request.
      * @param routes Call request possible routes.
      */
-    void PushTrialRoutes(std::vector<std::shared_ptr<Route>> routes);
+    void PushTrialRoutes(const std::vector<std::shared_ptr<Route>>& routes);
     /**
      * @brief Function to set a container of possible protection routes for
      * each working route to allocate the call request.
      * @param protection routes Call request possible routes.
      */
-    void PushTrialProtRoutes(std::vector<std::shared_ptr<Route>> routes);
+    void PushTrialProtRoutes(const std::vector<std::shared_ptr<Route>>& 
+    routes);
     /**
      * @brief Function to clear the container of possible routes to allocate
      * the call request.
@@ -89,14 +89,13 @@ public:
      * this call request.
      * @return Container of virtualized regenerators.
      */
-    std::vector<std::shared_ptr<Regenerator> > GetRegenerators() const;
+    std::vector<Regenerator*> GetRegenerators() const;
     /**
      * @brief Function to get the container of regenerators that will be used to 
      * allocate this call request.
      * @param regenerators Container of virtualized regenerators.
      */
-    void SetRegenerators(std::vector<std::shared_ptr<Regenerator> > 
-    regenerators);
+    void SetRegenerators(std::vector<Regenerator*> regenerators);
     /**
      * @brief Function to set the use of regeneration by this call request.
      */
@@ -112,13 +111,13 @@ public:
      * request. 
      * @return Container of BVTs.
      */
-    std::vector<std::shared_ptr<BVT>> GetTransponders() const;
+    std::vector<BVT*> GetTransponders() const;
     /**
      * @brief Function to get the container of BVTs that will be used to 
      * allocate this call request.
      * @param transponders Container of BVTs.
      */
-    void SetTransponders(std::vector<std::shared_ptr<BVT> > transponders);
+    void SetTransponders(std::vector<BVT*> transponders);
     /**
      * @brief Function to clear the container of BVTs used to allocate this 
      * call request.
@@ -138,7 +137,7 @@ private:
     /**
      * @brief Container of virtualized regenerators used by the call request.
      */
-    std::vector<std::shared_ptr<Regenerator>> regenerators;
+    std::vector<Regenerator*> regenerators;
     /**
      * @brief Information about the regeneration use.
      */
@@ -147,7 +146,7 @@ private:
     /**
      * @brief Container of BVTs used by the call request.
      */
-    std::vector<std::shared_ptr<BVT>> transponders;
+    std::vector<BVT*> transponders;
 
     bool protectionCall;
 };
@@ -37,7 +37,7 @@ enum EventType{
 /**
  * @brief Class that represents an event of a simulation.
  */
-class Event : public std::enable_shared_from_this<Event> {
+class Event {
     
     friend std::ostream& operator<<(std::ostream& ostream, 
     const Event* event);
@@ -55,6 +55,12 @@ public:
      */
     virtual ~Event();
     
+    /**
+     * @brief Function to reuse this event for a new call request.
+     * @param call Call request of this event.
+     * @param time Simulation time for event occurrence.
+     */
+    void Initialize(std::shared_ptr<Call> call, TIME time);
     /**
      * @brief Get the type of this event.
      * @return the Type of event.
@@ -86,11 +92,26 @@ public:
      * @return Pointer to a Call object.
      */
     Call* GetCall() const;
+    /**
+     * @brief Returns the shared pointer to the Call object of this Event.
+     * @return Shared pointer to a Call object.
+     */
+    std::shared_ptr<Call> GetSharedCall() const;
     /**
      * @brief Inputs the Call object in this Event.
      * @param call Pointer to a Call object
      */
     void SetCall(std::shared_ptr<Call> call);
+    /**
+     * @brief Returns the index of this event in the pool of the queue.
+     * @return Event index.
+     */
+    EventIndex GetIndex() const;
+    /**
+     * @brief Sets the index of this event in the pool of the queue.
+     * @param index Event index.
+     */
+    void SetIndex(EventIndex index);
     
     /**
      * @brief Function to implement an event, depending on the type.
@@ -124,6 +145,10 @@ private:
      * @brief Pointer to an Call object belong to this Event.
      */
     std::shared_ptr<Call> call;
+    /**
+     * @brief Index of this event in the pool of the event queue.
+     */
+    EventIndex index;
     /**
      * @brief Map that keeps the Events options 
      * and the name of each one.
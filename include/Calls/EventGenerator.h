@@ -23,32 +23,20 @@ class Data;
 class Traffic;
 class Event;
 class ResourceAlloc;
+class RandomStreams;
+class EventQueue;
+class EventTrace;
 
 #include <cassert>
 #include <memory>
 #include <random>
-#include <queue>
-#include <ctime>
+#include <chrono>
+#include <vector>
 
 /**
  * @brief Class responsible for events generation.
  */
 class EventGenerator {
-private:
-    /**
-     * @brief Structure to compare the events time.
-     * Used to organize the priority queue event used in the simulation.
-     */
-    struct EventCompare {
-        /**
-         * @brief Compare the time of two specified events.
-         * @param eventA First event.
-         * @param eventB Second event.
-         * @return True if eventA time is greater then eventB time.
-         */
-        bool operator()(const std::shared_ptr<Event> eventA,
-                        const std::shared_ptr<Event> eventB) const;
-    };
 public:
     /**
      * @brief Standard constructor for a CallGenerator object.
@@ -76,6 +64,11 @@ public:
      * @brief Erase the entire list of Events.
      */
     void Finalize();
+    /**
+     * @brief Erase the entire list of Events at the end of the warm-up of a
+     * run. The trace is kept open, so the run continues it.
+     */
+    void FinalizeWarmUp();
     /**
      * @brief Generate the Call and the Event, based in the distributions.
      * Push to the ordered list the new created event.
@@ -108,12 +101,33 @@ public:
      * Update the simulation time.
      * @return Top event object from the ordered list of events.
      */
-    std::shared_ptr<Event> GetNextEvent();
+    Event* GetNextEvent();
     /**
      * @brief Push an Event object to the ordered list of events.
      * @param evt
      */
-    void PushEvent(std::shared_ptr<Event> evt);
+    void PushEvent(Event* evt);
+    /**
+     * @brief Return an Event object, that is not in the ordered list of 
+     * events, to the pool of events, to be reused by a new call request.
+     * @param evt Event to release.
+     */
+    void ReleaseEvent(Event* evt);
+    /**
+     * @brief Function to get the calls in progress, with the times of their
+     * ends.
+     * @return Container of end times and calls.
+     */
+    std::vector<std::pair<TIME, std::shared_ptr<Call>>> GetActiveCalls() 
+    const;
+    /**
+     * @brief Function to replace the events of the queue by the ends of the
+     * calls in progress, and set the simulation time.
+     * @param simulationTime Simulation time.
+     * @param activeCalls Container of end times and calls.
+     */
+    void SetActiveCalls(TIME simulationTime, 
+    const std::vector<std::pair<TIME, std::shared_ptr<Call>>>& activeCalls);
     
     /**
      * @brief Get the simulation that owns this object.
@@ -145,6 +159,12 @@ public:
      * @param realSimullationTime Computer simulation time.
      */
     void SetRealSimulationTime(TIME realSimullationTime);
+    /**
+     * @brief Function to get the number of events taken from the ordered 
+     * list since the last initialization.
+     * @return Number of events.
+     */
+    NumRequest GetNumberEvents() const;
 private:
     /**
      * @brief Function responsible to create a call request.
@@ -160,9 +180,13 @@ private:
     std::shared_ptr<Call> CreateCall(unsigned orNodeIndex, unsigned deNodeIndex,
                                      unsigned trafficIndex, TIME deactTime, bool protectionCall);
     
-    void LoadRandomGenerator();
-    
     void InitializeGenerator();
+    /**
+     * @brief Function to start the record or replay of the trace of this 
+     * run, based on the request trace option. A trace opened by the warm-up
+     * of the run is continued.
+     */
+    void InitializeTrace();
 private:
     /**
      * @breif Pointer to a SimulationType object that
@@ -190,10 +214,10 @@ private:
     ResourceAlloc* resourceAlloc;
     
     /**
-     * @brief Random engine responsible for the
-     * random distributions.
+     * @brief Pointer to the random streams of the simulation, used by
+     * the random distributions.
      */
-    static std::default_random_engine random_generator;
+    RandomStreams* randomStreams;
     /**
      * @brief Distribution responsible to generate 
      * the random node index.
@@ -214,6 +238,11 @@ private:
      * the inter-arrival time.
      */
     std::exponential_distribution<TIME> exponencialHDistribution;
+    /**
+     * @brief Distribution responsible to generate the protection type of
+     * the call.
+     */
+    std::uniform_int_distribution<int> uniformProtectionDistribution;
     /**
      * @brief Network load (Erlangs).
      */
@@ -226,12 +255,20 @@ private:
      * @brief Computer simulation time.
      */
     TIME realSimulationTime;
+    /**
+     * @brief Number of events taken from the ordered list since the last 
+     * initialization.
+     */
+    NumRequest numberEvents;
     /**
      * @brief List with the Event objects ordered based on those times.
      */
-    std::priority_queue<std::shared_ptr<Event>,
-                        std::vector<std::shared_ptr<Event>>,
-                        EventCompare> queueEvents;
+    std::unique_ptr<EventQueue> queueEvents;
+    /**
+     * @brief Trace of the call requests of the run, created if the trace
+     * is recorded or replayed.
+     */
+    std::unique_ptr<EventTrace> eventTrace;
 };
 
 #endif /* CALLGENERATOR_H */
@@ -0,0 +1,140 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   EventQueue.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 3:24 PM
+ */
+
+#ifndef EVENTQUEUE_H
+#define EVENTQUEUE_H
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <cassert>
+
+class EventGenerator;
+class Call;
+
+#include "Event.h"
+#include "../GeneralClasses/Def.h"
+
+/**
+ * @brief Class EventQueue keeps the events of a simulation ordered by time.
+ * The events are stored in a pool and reused after released, and the 
+ * ordering is done by a d-ary heap of event indexes and times.
+ */
+class EventQueue {
+private:
+    /**
+     * @brief Entry of the heap, with the time and the pool index of an 
+     * event.
+     */
+    struct HeapEntry {
+        /**
+         * @brief Time of the event.
+         */
+        TIME time;
+        /**
+         * @brief Index of the event in the pool.
+         */
+        EventIndex index;
+    };
+public:
+    /**
+     * @brief Default constructor of an EventQueue object.
+     */
+    EventQueue();
+    /**
+     * @brief Virtual destructor of an EventQueue object.
+     */
+    virtual ~EventQueue();
+    
+    /**
+     * @brief Function to get an event from the pool, reusing a released 
+     * event if there is one.
+     * @param generator Event generator of the event.
+     * @param call Call request of the event.
+     * @param time Simulation time for event occurrence.
+     * @return Pointer to the event.
+     */
+    Event* CreateEvent(EventGenerator* generator, std::shared_ptr<Call> call,
+                       TIME time);
+    /**
+     * @brief Function to return an event to the pool. The event must not be 
+     * in the queue.
+     * @param evt Event to release.
+     */
+    void ReleaseEvent(Event* evt);
+    /**
+     * @brief Push an event to the queue, based on its actual time.
+     * @param evt Event created by this queue.
+     */
+    void Push(Event* evt);
+    /**
+     * @brief Remove the first event of the queue.
+     * @return Event with the lowest time.
+     */
+    Event* Pop();
+    /**
+     * @brief Checks if the queue is empty.
+     * @return True if there is no event in the queue.
+     */
+    bool IsEmpty() const;
+    /**
+     * @brief Function to get the number of events in the queue.
+     * @return Number of events.
+     */
+    unsigned int GetNumEvents() const;
+    /**
+     * @brief Function to get an event of the queue. The positions do not 
+     * follow the order of the events times.
+     * @param pos Position of the event, lower than the number of events.
+     * @return Event.
+     */
+    const Event* GetEvent(unsigned int pos) const;
+    /**
+     * @brief Remove all events of the queue and release them to the pool.
+     */
+    void Clear();
+private:
+    /**
+     * @brief Move an entry of the heap up, until its parent has a lower 
+     * time.
+     * @param pos Position of the entry in the heap.
+     */
+    void SiftUp(unsigned int pos);
+    /**
+     * @brief Move an entry of the heap down, until all its children have 
+     * a higher time.
+     * @param pos Position of the entry in the heap.
+     */
+    void SiftDown(unsigned int pos);
+private:
+    /**
+     * @brief Number of children of each heap node.
+     */
+    static const unsigned int arity;
+    /**
+     * @brief Pool of events. A deque keeps the events addresses when it 
+     * grows.
+     */
+    std::deque<Event> events;
+    /**
+     * @brief Indexes of the released events of the pool.
+     */
+    std::vector<EventIndex> freeEvents;
+    /**
+     * @brief Heap of the queued events.
+     */
+    std::vector<HeapEntry> heap;
+};
+
+#endif /* EVENTQUEUE_H */
+
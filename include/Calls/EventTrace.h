@@ -0,0 +1,169 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   EventTrace.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:14 PM
+ */
+
+#ifndef EVENTTRACE_H
+#define EVENTTRACE_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include "../GeneralClasses/Def.h"
+
+/**
+ * @brief Call request kept in a trace file. The times are kept as they
+ * were generated, so a replay gives the same events of the recorded run.
+ */
+struct TraceCall {
+    /**
+     * @brief Time between the previous call request and this one.
+     */
+    TIME interArrivalTime;
+    /**
+     * @brief Holding time of the call.
+     */
+    TIME holdingTime;
+    /**
+     * @brief Source node index.
+     */
+    std::uint16_t orNode;
+    /**
+     * @brief Destination node index.
+     */
+    std::uint16_t deNode;
+    /**
+     * @brief Traffic container index.
+     */
+    std::uint16_t traffic;
+    /**
+     * @brief Indicates if the call requires protection.
+     */
+    std::uint8_t protection;
+    /**
+     * @brief Unused byte, kept as zero.
+     */
+    std::uint8_t unused;
+};
+
+/**
+ * @brief Class responsible for the trace file of the call requests of a
+ * simulation run. In the record mode the requests are written in blocks. In
+ * the replay mode the file is mapped in memory and the requests are read in
+ * place, without any copy or random number generation.
+ */
+class EventTrace {
+public:
+    /**
+     * @brief Standard constructor of an EventTrace object.
+     * @param numNodes Number of nodes of the topology.
+     * @param numTraffic Number of traffic classes.
+     */
+    EventTrace(unsigned int numNodes, unsigned int numTraffic);
+    /**
+     * @brief Virtual destructor of an EventTrace object.
+     */
+    virtual ~EventTrace();
+
+    /**
+     * @brief Function to start the record of a trace file. The file is
+     * written with a temporary name, and renamed when closed.
+     * @param fileName Name of the trace file.
+     */
+    void OpenRecord(const std::string& fileName);
+    /**
+     * @brief Function to start the replay of a trace file.
+     * @param fileName Name of the trace file.
+     */
+    void OpenReplay(const std::string& fileName);
+    /**
+     * @brief Function to finish the record or replay of the trace file.
+     */
+    void Close();
+    /**
+     * @brief Function to check if a trace file is being recorded or 
+     * replayed.
+     * @return True if the trace is open.
+     */
+    bool IsOpen() const;
+
+    /**
+     * @brief Function to add a call request to the recorded trace.
+     * @param record Call request.
+     */
+    void Write(const TraceCall& record);
+    /**
+     * @brief Function to get the next call request of the replayed trace.
+     * @return Call request, kept in the mapped file.
+     */
+    const TraceCall& Read();
+private:
+    /**
+     * @brief Function to write the records kept in the buffer.
+     */
+    void Flush();
+private:
+    /**
+     * @brief Number of nodes of the topology.
+     */
+    unsigned int numNodes;
+    /**
+     * @brief Number of traffic classes.
+     */
+    unsigned int numTraffic;
+    /**
+     * @brief Name of the trace file.
+     */
+    std::string fileName;
+    /**
+     * @brief Temporary name of the recorded trace file.
+     */
+    std::string tempName;
+    /**
+     * @brief Recorded trace file.
+     */
+    std::ofstream file;
+    /**
+     * @brief Records not yet written in the recorded trace file.
+     */
+    std::vector<TraceCall> buffer;
+    /**
+     * @brief Mapping of the replayed trace file.
+     */
+    boost::interprocess::file_mapping mapping;
+    /**
+     * @brief Mapped region of the replayed trace file.
+     */
+    boost::interprocess::mapped_region region;
+    /**
+     * @brief First record of the replayed trace file.
+     */
+    const TraceCall* records;
+    /**
+     * @brief Number of records of the replayed trace file.
+     */
+    std::size_t numRecords;
+    /**
+     * @brief Index of the next record to be replayed.
+     */
+    std::size_t nextRecord;
+    /**
+     * @brief Version of the trace file format.
+     */
+    static const std::uint32_t version;
+};
+
+#endif /* EVENTTRACE_H */
+
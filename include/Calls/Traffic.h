@@ -15,9 +15,13 @@
 #define TRAFFIC_H
 
 #include <vector>
+#include <string>
+#include <cstdint>
 
 class SimulationType;
 
+#include "../GeneralClasses/AliasTable.h"
+
 /**
  * @brief Class Traffic represents the traffic of a simulation.
  */
@@ -43,9 +47,27 @@ public:
     virtual ~Traffic();
     
     /**
-     * @brief  Loads the traffic from a .txt file.
+     * @brief  Loads the traffic from a .txt file. With the traffic matrix 
+     * option, the traffic matrix of the topology is also loaded.
      */
     void LoadFile();
+    /**
+     * @brief Function to check if the call requests are drawn from a traffic
+     * matrix.
+     * @return True if a traffic matrix is loaded.
+     */
+    bool IsMatrixLoaded() const;
+    /**
+     * @brief Function to draw the node pair and traffic class of a call 
+     * request from the traffic matrix.
+     * @param engine Random engine.
+     * @param orNode Drawn source node index.
+     * @param deNode Drawn destination node index.
+     * @param trafficIndex Drawn traffic index.
+     */
+    void DrawMatrixRequest(RandomStreams::Engine& engine, 
+    unsigned int& orNode, unsigned int& deNode, unsigned int& trafficIndex)
+    const;
     
     /**
      * Returns the vector with all traffic values.
@@ -70,6 +92,52 @@ public:
      */
     unsigned int GetTrafficIndex(double bitRate) const;
 private:
+    /**
+     * @brief Loads the traffic matrix from the text file, and saves it in 
+     * the binary file for the next simulations. 
+     * 
+     * The text file has the number of nodes and traffic classes, followed 
+     * by one line per node pair: source node, destination node, arrival 
+     * rate and the share of each traffic class. The rate of a pair is 
+     * split among its classes in proportion to their shares, and the pairs
+     * not listed have no call requests.
+     */
+    void LoadMatrixText();
+    /**
+     * @brief Loads the traffic matrix from the binary file.
+     */
+    void LoadMatrixBinary();
+    /**
+     * @brief Saves a traffic matrix in the binary file. The file has a 
+     * header with the signature, the version, the number of nodes and the 
+     * number of traffic classes, followed by the arrival rate of each 
+     * source node, destination node and traffic class, in this order, as 
+     * 32-bit floats. The file is not rewritten if it already holds the 
+     * same matrix.
+     * @param matrix Arrival rates of the traffic matrix.
+     * @param numNodes Number of nodes of the matrix.
+     */
+    void SaveMatrixBinary(const std::vector<float>& matrix, 
+    unsigned int numNodes) const;
+    /**
+     * @brief Checks if the size of a traffic matrix matches the topology 
+     * and the traffic classes. Ends the simulator if it does not.
+     * @param numNodes Number of nodes of the matrix.
+     * @param numClasses Number of traffic classes of the matrix.
+     * @param fileName Name of the traffic matrix file.
+     */
+    void CheckMatrixSize(unsigned int numNodes, unsigned int numClasses,
+    const std::string& fileName) const;
+    /**
+     * @brief Builds the alias table of the requests of a traffic matrix,
+     * with the arrival rates as weights.
+     * @param matrix Arrival rates of the traffic matrix.
+     * @param numNodes Number of nodes of the matrix.
+     * @param fileName Name of the traffic matrix file.
+     */
+    void CreateMatrixTable(const std::vector<float>& matrix, 
+    unsigned int numNodes, const std::string& fileName);
+    
     /**
      * @brief A pointer to the simulation this object belong.
      */
@@ -78,6 +146,23 @@ private:
      * @brief Vector that storage all traffic values.
      */
     std::vector<double> vecTraffic;
+    /**
+     * @brief Number of nodes of the traffic matrix.
+     */
+    unsigned int matrixNumNodes;
+    /**
+     * @brief Matrix position of each request with positive arrival rate, 
+     * indexed as the alias table.
+     */
+    std::vector<unsigned int> matrixEntries;
+    /**
+     * @brief Alias table of the traffic matrix requests.
+     */
+    AliasTable matrixTable;
+    /**
+     * @brief Version of the binary traffic matrix file.
+     */
+    static const std::uint32_t matrixVersion;
 };
 
 #endif /* TRAFFIC_H */
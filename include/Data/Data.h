@@ -28,6 +28,18 @@ class Topology;
 
 #include "../Calls/EventGenerator.h"
 
+/**
+ * @brief Metrics stored for each replication of a load point.
+ */
+enum ReplicationMetric{
+    ReplicReqBP,
+    ReplicSlotsBP,
+    ReplicNetUtiliz,
+    ReplicNetFrag,
+    FirstReplicMetric = ReplicReqBP,
+    LastReplicMetric = ReplicNetFrag
+};
+
 /**
  * @brief The Data class is responsible to storage the simulation data.
  */
@@ -63,6 +75,28 @@ public:
      * @param numPos Number of points.
      */
     void Initialize(unsigned int numPos);
+    /**
+     * @brief Function to copy the data of a specified point from another
+     * Data object, with the same number of points.
+     * @param data Data object to copy from.
+     * @param index Index of the point.
+     */
+    void CopyPoint(const Data* data, unsigned int index);
+    /**
+     * @brief Function to clear the data of a specified point, so it can be
+     * simulated again.
+     * @param index Index of the point.
+     */
+    void ClearPoint(unsigned int index);
+    /**
+     * @brief Function to add the metrics of the actual point of another Data
+     * object as a replication of the same point of this Data. The 
+     * replications are kept until all the previous ones are added, and the
+     * ones after the convergence of the point are not used.
+     * @param data Data object of the replication.
+     * @param replication Index of the replication.
+     */
+    void AddReplication(const Data* data, unsigned int replication);
     /**
      * @brief Update the data based on the call.
      * If call is Accepted, increment the number of accepted requests.
@@ -133,6 +167,12 @@ public:
     * @brief Saves the data values in the numHopsRoutes.txt file.
     */
     void SaveNumHopsRoutes();
+    /**
+     * @brief Save the results of all load points in the columnar files 
+     * chosen in the options: one CSV file with all tables and, optionally, 
+     * a binary file with all tables.
+     */
+    void SaveResults();
     /**
      * @brief Saves the genetic algorithms files. Log, initial population, 
      * best individuals, worst individuals and best individual of the last
@@ -339,8 +379,56 @@ public:
     * @return network alpha average.
     */
     double GetNetAlphaAverage() const;
+    /**
+     * @brief Function to get the number of replications stored for the 
+     * actual point.
+     * @return Number of replications.
+     */
+    unsigned int GetNumReplications() const;
+    /**
+     * @brief Function to get the mean of a metric over the replications of 
+     * the actual point.
+     * @param metric Replication metric.
+     * @return Sample mean.
+     */
+    double GetReplicMean(ReplicationMetric metric) const;
+    /**
+     * @brief Function to get the variance of a metric over the replications
+     * of the actual point.
+     * @param metric Replication metric.
+     * @return Sample variance.
+     */
+    double GetReplicVariance(ReplicationMetric metric) const;
+    /**
+     * @brief Function to get the half-width of the 95% confidence interval 
+     * of the mean of a metric, for the actual point.
+     * @param metric Replication metric.
+     * @return Confidence interval half-width.
+     */
+    double GetReplicConfInterval(ReplicationMetric metric) const;
+    /**
+     * @brief Check if the confidence interval of the call request blocking
+     * probability of the actual point reached a target precision.
+     * @param precision Half-width target, relative to the mean.
+     * @return True if the target is reached.
+     */
+    bool IsReplicConverged(double precision) const;
+    /**
+     * @brief Function to get the two-sided 95% quantile of the Student's t
+     * distribution.
+     * @param numSamples Number of samples of the mean, at least 2.
+     * @return Quantile.
+     */
+    static double GetStudentQuantile(unsigned int numSamples);
 
 private:
+    /**
+     * @brief Function to save the replication statistics of a metric, for 
+     * the actual point, into a output stream.
+     * @param ostream Output stream.
+     * @param metric Replication metric.
+     */
+    void SaveReplications(std::ostream& ostream, ReplicationMetric metric);
     /**
      * @brief Saves the data in PBvLoad.txt.
      * @param ostream Stream that contain the PBvLoad file.
@@ -582,6 +670,15 @@ private:
      * simulation, to indicate the position of the vector to update the data.
      */
     unsigned int actualIndex;
+    /**
+     * @brief Values of each replication metric, per load point and metric.
+     */
+    std::vector<std::vector<std::vector<double>>> replicValues;
+    /**
+     * @brief Values of the replications that finished before a previous
+     * one, per load point and replication index.
+     */
+    std::vector<std::map<unsigned int, std::vector<double>>> replicPending;
 };
 
 #endif /* DATA_H */
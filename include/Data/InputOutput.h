@@ -55,6 +55,13 @@ public:
      * @param traffic stream that operates in Traffic file.
      */
     void LoadTraffic(std::ifstream& traffic);
+    /**
+     * @brief Function responsible for access the traffic matrix file of the
+     * topology.
+     * @param matrix Stream that operates in the traffic matrix file.
+     * @param binary True to access the binary file, false to the text file.
+     */
+    void LoadTrafficMatrix(std::ifstream& matrix, bool binary);
     /**
      * @brief Function to load the basic GA parameters file.
      * @param gaParam Input file.
@@ -90,6 +97,45 @@ public:
     void LoadPSO(std::ifstream& psoFile);
     
     void LoadCoefficientsSCRA(std::ifstream& coeSCRA);
+    /**
+     * @brief Function to check if the input files required by the loaded
+     * options exist. The missing files are printed. The files written by 
+     * other simulations are not checked.
+     * @return True if all files exist.
+     */
+    bool CheckInputFiles() const;
+    /**
+     * @brief Function to get the name of the offline resource tables cache
+     * file of a given key. The file may not exist.
+     * @param key Hexadecimal key of the cached tables.
+     * @return Name of the cache file.
+     */
+    std::string GetResourcesCacheName(const std::string& key) const;
+    /**
+     * @brief Function to get the name of the request trace file of a
+     * simulation run. The name does not depend on the simulation index, so
+     * simulations with other options can replay the same trace.
+     * @param loadPoint Load point index.
+     * @param replication Replication index.
+     * @return Name of the trace file.
+     */
+    std::string GetTraceName(unsigned int loadPoint, 
+                             unsigned int replication) const;
+    /**
+     * @brief Function to get the name of the traffic matrix file of the 
+     * topology.
+     * @param binary True for the binary file, false for the text file.
+     * @return Name of the traffic matrix file.
+     */
+    std::string GetTrafficMatrixName(bool binary) const;
+    /**
+     * @brief Function to get the name of a columnar result file of this 
+     * simulation.
+     * @param suffix Part of the name after the Results prefix, with the 
+     * extension.
+     * @return Name of the result file.
+     */
+    std::string GetResultsName(const std::string& suffix) const;
     
     /**
      * @brief Get the Log.txt ofstream.
@@ -206,7 +252,27 @@ public:
      * @param max Progress maximum value.
      */
     void PrintProgressBar(unsigned actual, unsigned min, unsigned max);
+    /**
+     * @brief Function to set if the simulator runs with a user at the 
+     * terminal. Without it, a missing file ends the simulator instead of 
+     * waiting for the user to fix it.
+     * @param interactive True if interactive.
+     */
+    static void SetInteractive(bool interactive);
+    /**
+     * @brief Function to check if the simulator runs with a user at the 
+     * terminal.
+     * @return True if interactive.
+     */
+    static bool IsInteractive();
 private:
+    /**
+     * @brief Function to wait for the user to fix a missing file. In 
+     * non-interactive mode, ends the simulator with the missing file exit 
+     * code.
+     * @param missing What is missing, the file or its folder.
+     */
+    void WaitFileFix(const std::string& missing) const;
     /**
      * @brief Function to load the .txt file to output the blocking probability
      * as function of the network load.
@@ -373,6 +439,10 @@ private:
      * @brief Size of the progress bar.
      */
     static const int barWidth = 30;
+    /**
+     * @brief Indicates if the simulator runs with a user at the terminal.
+     */
+    static bool interactive;
 };
 
 #endif /* INPUTOUTPUT_H */
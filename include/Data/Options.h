@@ -222,8 +222,9 @@ enum RegAssignmentOption {
 enum StopCriteria {
     NumCallRequestsMaximum,
     NumCallRequestsBlocked,
+    BlockingConverged,
     FirstStopCriteria = NumCallRequestsMaximum,
-    LastStopCriteria = NumCallRequestsBlocked
+    LastStopCriteria = BlockingConverged
 };
 
 enum RandomGenerationOption {
@@ -252,6 +253,52 @@ enum FragMeasureOption {
     FragMetricABP
 };
 
+enum ExecutionOption {
+    ExecutionSequential,
+    ExecutionParallel,
+    FirstExecutionOption = ExecutionSequential,
+    LastExecutionOption = ExecutionParallel
+};
+
+enum CacheOption {
+    CacheDisabled,
+    CacheEnabled,
+    FirstCacheOption = CacheDisabled,
+    LastCacheOption = CacheEnabled
+};
+
+enum TraceOption {
+    TraceDisabled,
+    TraceRecord,
+    TraceReplay,
+    FirstTraceOption = TraceDisabled,
+    LastTraceOption = TraceReplay
+};
+
+enum TransientOption {
+    TransientDisabled,
+    TransientFixed,
+    TransientMSER,
+    FirstTransientOption = TransientDisabled,
+    LastTransientOption = TransientMSER
+};
+
+enum ResultOption {
+    ResultText,
+    ResultCsv,
+    ResultCsvBinary,
+    FirstResultOption = ResultText,
+    LastResultOption = ResultCsvBinary
+};
+
+enum TrafficMatrixOption {
+    TrafficMatrixUniform,
+    TrafficMatrixText,
+    TrafficMatrixBinary,
+    FirstTrafficMatrixOption = TrafficMatrixUniform,
+    LastTrafficMatrixOption = TrafficMatrixBinary
+};
+
 /**
  * @brief The Options class is responsible for storage the simulation
  * options.
@@ -509,6 +556,42 @@ public:
     
     void SetFragMeasureOption(FragMeasureOption fragMeasureOption);
     
+    ExecutionOption GetExecutionOption() const;
+    
+    std::string GetExecutionOptionName() const;
+    
+    void SetExecutionOption(ExecutionOption executionOption);
+    
+    CacheOption GetCacheOption() const;
+    
+    std::string GetCacheOptionName() const;
+    
+    void SetCacheOption(CacheOption cacheOption);
+    
+    TraceOption GetTraceOption() const;
+    
+    std::string GetTraceOptionName() const;
+    
+    void SetTraceOption(TraceOption traceOption);
+    
+    TransientOption GetTransientOption() const;
+    
+    std::string GetTransientOptionName() const;
+    
+    void SetTransientOption(TransientOption transientOption);
+    
+    ResultOption GetResultOption() const;
+    
+    std::string GetResultOptionName() const;
+    
+    void SetResultOption(ResultOption resultOption);
+    
+    TrafficMatrixOption GetTrafficMatrixOption() const;
+    
+    std::string GetTrafficMatrixOptionName() const;
+    
+    void SetTrafficMatrixOption(TrafficMatrixOption trafficMatrixOption);
+    
 private:
     /**
      * @brief A pointer to the simulation this object belong.
@@ -584,6 +667,36 @@ private:
     ProtectionOption protectionOption;
     
     FragMeasureOption fragMeasureOpion;
+    /**
+     * @brief Option to determine if the load points are simulated 
+     * sequentially or in parallel.
+     */
+    ExecutionOption executionOption;
+    /**
+     * @brief Option to determine if the offline resource tables are kept
+     * in an on-disk cache.
+     */
+    CacheOption cacheOption;
+    /**
+     * @brief Option to record the call requests of the simulation in a trace
+     * file, or to replay them from it.
+     */
+    TraceOption traceOption;
+    /**
+     * @brief Option to remove the initial transient of each run from the
+     * statistics.
+     */
+    TransientOption transientOption;
+    /**
+     * @brief Option to write the results in columnar files, besides the
+     * text files.
+     */
+    ResultOption resultOption;
+    /**
+     * @brief Option to draw the node pair and traffic class of the call 
+     * requests from a traffic matrix file, instead of uniformly.
+     */
+    TrafficMatrixOption trafficMatrixOption;
     
     /**
      * @brief Map that keeps the topology option 
@@ -687,6 +800,36 @@ private:
     
     static const boost::unordered_map<FragMeasureOption, 
     std::string> mapFragMeasureOption;
+    /**
+     * @brief Map the execution options and their respective names.
+     */
+    static const boost::unordered_map<ExecutionOption, 
+    std::string> mapExecutionOption;
+    /**
+     * @brief Map the offline tables cache options and their respective names.
+     */
+    static const boost::unordered_map<CacheOption, 
+    std::string> mapCacheOption;
+    /**
+     * @brief Map the request trace options and their respective names.
+     */
+    static const boost::unordered_map<TraceOption, 
+    std::string> mapTraceOption;
+    /**
+     * @brief Map the transient removal options and their respective names.
+     */
+    static const boost::unordered_map<TransientOption, 
+    std::string> mapTransientOption;
+    /**
+     * @brief Map the result format options and their respective names.
+     */
+    static const boost::unordered_map<ResultOption, 
+    std::string> mapResultOption;
+    /**
+     * @brief Map the traffic matrix options and their respective names.
+     */
+    static const boost::unordered_map<TrafficMatrixOption, 
+    std::string> mapTrafficMatrixOption;
 };
 
 #endif /* OPTIONS_H */
@@ -244,6 +244,84 @@ public:
     * @param numberMPRGroups Number of MPR groups of disjoint routes.
     */
     void SetNumberMPRGroups(unsigned int numberMPRGroups);
+    /**
+     * @brief Function to get the number of independent replications of each
+     * load point.
+     * @return Number of replications.
+     */
+    unsigned int GetNumberReplications() const;
+    /**
+     * @brief Function to set the number of independent replications of each
+     * load point.
+     * @param numberReplications Number of replications.
+     */
+    void SetNumberReplications(unsigned int numberReplications);
+    /**
+     * @brief Function to get the target of the confidence interval half-width
+     * of the call request blocking probability, relative to its mean.
+     * @return Relative half-width target. Zero if the replications do not 
+     * stop early.
+     */
+    double GetReplicationsPrecision() const;
+    /**
+     * @brief Function to set the target of the confidence interval half-width
+     * of the call request blocking probability, relative to its mean.
+     * @param replicationsPrecision Relative half-width target.
+     */
+    void SetReplicationsPrecision(double replicationsPrecision);
+    /**
+     * @brief Function to get the number of call requests simulated before 
+     * the network snapshot is taken.
+     * @return Number of warm-up requests. Zero if there is no warm-up.
+     */
+    double GetNumberWarmUpReq() const;
+    /**
+     * @brief Function to set the number of call requests simulated before 
+     * the network snapshot is taken.
+     * @param numberWarmUpReq Number of warm-up requests.
+     */
+    void SetNumberWarmUpReq(double numberWarmUpReq);
+    /**
+     * @brief Function to get the number of call requests of each run 
+     * removed from the statistics as transient, with the fixed transient 
+     * removal.
+     * @return Number of transient requests.
+     */
+    double GetNumberTransientReq() const;
+    /**
+     * @brief Function to set the number of call requests of each run 
+     * removed from the statistics as transient, with the fixed transient 
+     * removal.
+     * @param numberTransientReq Number of transient requests.
+     */
+    void SetNumberTransientReq(double numberTransientReq);
+    /**
+     * @brief Function to get the number of call requests of each batch of
+     * the transient detection and of the convergence stop criterion.
+     * @return Number of requests per batch.
+     */
+    double GetNumberBatchReq() const;
+    /**
+     * @brief Function to set the number of call requests of each batch of
+     * the transient detection and of the convergence stop criterion.
+     * @param numberBatchReq Number of requests per batch.
+     */
+    void SetNumberBatchReq(double numberBatchReq);
+    /**
+     * @brief Function to get the target of the confidence interval 
+     * half-width of the call request blocking probability of the batches, 
+     * relative to its mean.
+     * @return Relative half-width target. Zero if the runs do not stop by
+     * convergence.
+     */
+    double GetBatchPrecision() const;
+    /**
+     * @brief Function to set the target of the confidence interval 
+     * half-width of the call request blocking probability of the batches, 
+     * relative to its mean.
+     * @param batchPrecision Relative half-width target.
+     */
+    void SetBatchPrecision(double batchPrecision);
     
     
 private:
@@ -328,6 +406,38 @@ private:
      * by PDPP Scheme.
     */
     unsigned int numberMPRGroups;
+    /**
+     * @brief Number of independent replications of each load point.
+     */
+    unsigned int numberReplications;
+    /**
+     * @brief Target of the 95% confidence interval half-width of the call 
+     * request blocking probability, relative to its mean. The replications
+     * of a load point stop once it is reached.
+     */
+    double replicationsPrecision;
+    /**
+     * @brief Number of call requests simulated from an empty network before
+     * the snapshot of the network is taken. The runs with the same load 
+     * and run index start from this snapshot.
+     */
+    double numberWarmUpReq;
+    /**
+     * @brief Number of call requests of each run removed from the 
+     * statistics, with the fixed transient removal.
+     */
+    double numberTransientReq;
+    /**
+     * @brief Number of call requests of each batch of the transient 
+     * detection and of the convergence stop criterion.
+     */
+    double numberBatchReq;
+    /**
+     * @brief Target of the 95% confidence interval half-width of the call
+     * request blocking probability of the batches, relative to its mean. 
+     * The runs with the convergence stop criterion end once it is reached.
+     */
+    double batchPrecision;
 
 private:
     /**
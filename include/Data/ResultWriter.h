@@ -0,0 +1,159 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   ResultWriter.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:39 PM
+ */
+
+#ifndef RESULTWRITER_H
+#define RESULTWRITER_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <initializer_list>
+#include <utility>
+
+/**
+ * @brief Types of the values of a result column.
+ */
+enum ResultColumnType {
+    ResultUnsigned,
+    ResultDouble
+};
+
+/**
+ * @brief Column of a result table. The values are kept as doubles and
+ * written with the type of the column.
+ */
+struct ResultColumn {
+    /**
+     * @brief Name of the column.
+     */
+    std::string name;
+    /**
+     * @brief Type of the values of the column.
+     */
+    ResultColumnType type;
+    /**
+     * @brief Values of the column, one for each row.
+     */
+    std::vector<double> values;
+};
+
+/**
+ * @brief Table of results kept by columns.
+ */
+class ResultTable {
+public:
+    /**
+     * @brief Standard constructor of a ResultTable object.
+     * @param name Name of the table.
+     * @param columns Names and types of the columns.
+     */
+    ResultTable(const std::string& name,
+    std::initializer_list<std::pair<std::string, ResultColumnType>> columns);
+
+    /**
+     * @brief Function to add a row to the table.
+     * @param values Values of the row, one for each column.
+     */
+    void AddRow(std::initializer_list<double> values);
+    /**
+     * @brief Function to get the name of the table.
+     * @return Name of the table.
+     */
+    const std::string& GetName() const;
+    /**
+     * @brief Function to get the columns of the table.
+     * @return Columns of the table.
+     */
+    const std::vector<ResultColumn>& GetColumns() const;
+    /**
+     * @brief Function to get the number of rows of the table.
+     * @return Number of rows.
+     */
+    std::size_t GetNumRows() const;
+private:
+    /**
+     * @brief Name of the table.
+     */
+    std::string name;
+    /**
+     * @brief Columns of the table.
+     */
+    std::vector<ResultColumn> columns;
+    /**
+     * @brief Number of rows of the table.
+     */
+    std::size_t numRows;
+};
+
+/**
+ * @brief Class ResultWriter keeps the result tables of a simulation in
+ * memory and writes them at once. All the tables are written in a single
+ * CSV file in long format, and can also be written in a single binary file,
+ * with the values of each column stored together.
+ */
+class ResultWriter {
+public:
+    /**
+     * @brief Standard constructor of a ResultWriter object.
+     */
+    ResultWriter();
+    /**
+     * @brief Virtual destructor of a ResultWriter object.
+     */
+    virtual ~ResultWriter();
+
+    /**
+     * @brief Function to add a table to the writer.
+     * @param table Table of results.
+     */
+    void AddTable(const ResultTable& table);
+    /**
+     * @brief Function to write all tables in a CSV file in long format. 
+     * Each line has the table name, the row index, the column name and the 
+     * value of one cell.
+     * @param fileName Name of the CSV file.
+     */
+    void WriteCsv(const std::string& fileName) const;
+    /**
+     * @brief Function to write all tables in a binary file.
+     * @param fileName Name of the binary file.
+     */
+    void WriteBinary(const std::string& fileName) const;
+private:
+    /**
+     * @brief Function to write a buffer in a file at once.
+     * @param fileName Name of the file.
+     * @param buffer Contents of the file.
+     */
+    static void WriteFile(const std::string& fileName,
+                          const std::string& buffer);
+    /**
+     * @brief Function to append a value to a binary buffer.
+     * @param buffer Binary buffer.
+     * @param value Value.
+     */
+    template<class T>
+    static void Append(std::string& buffer, T value);
+private:
+    /**
+     * @brief Tables of results.
+     */
+    std::vector<ResultTable> tables;
+    /**
+     * @brief Version of the binary file format.
+     */
+    static const std::uint32_t version;
+};
+
+#endif /* RESULTWRITER_H */
+
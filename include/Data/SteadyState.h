@@ -0,0 +1,144 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   SteadyState.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:32 PM
+ */
+
+#ifndef STEADYSTATE_H
+#define STEADYSTATE_H
+
+#include <vector>
+
+class SimulationType;
+
+#include "Options.h"
+
+/**
+ * @brief Class SteadyState follows the call request blocking probability
+ * of a run in batches of requests. It finds the end of the initial
+ * transient of the run, by a fixed number of requests or by the MSER rule
+ * over the batches, and checks if the 95% confidence interval of the
+ * batches reached the target precision.
+ */
+class SteadyState {
+public:
+    /**
+     * @brief Standard constructor of a SteadyState object.
+     * @param simulType SimulationType object that owns this object.
+     */
+    SteadyState(SimulationType* simulType);
+    /**
+     * @brief Virtual destructor of a SteadyState object.
+     */
+    virtual ~SteadyState();
+
+    /**
+     * @brief Function to start the batches of a run. The run is in steady
+     * state from the start if the transient removal is disabled.
+     */
+    void Initialize();
+    /**
+     * @brief Function to check the requests evaluated since the last call.
+     * It closes the batch when it is complete, and checks the end of the
+     * transient and the convergence.
+     * @return True if the transient ended now, so the statistics must be
+     * restarted.
+     */
+    bool Update();
+    /**
+     * @brief Function to check if the transient of the run ended.
+     * @return True if the run is in steady state.
+     */
+    bool IsSteady() const;
+    /**
+     * @brief Function to check if the confidence interval of the blocking
+     * probability of the batches in steady state reached the target
+     * precision.
+     * @return True if the target is reached.
+     */
+    bool IsConverged() const;
+    /**
+     * @brief Function to restart the batches from the requests of the 
+     * actual statistics. Called after the statistics are restarted at the 
+     * end of the transient.
+     */
+    void Restart();
+private:
+    /**
+     * @brief Function to find the truncation point of the MSER rule over
+     * the batches.
+     * @return True if the truncation point is in the first half of the
+     * batches, so the transient ended.
+     */
+    bool CheckMSER() const;
+    /**
+     * @brief Function to update the convergence with the last batch.
+     */
+    void CheckConvergence();
+private:
+    /**
+     * @brief SimulationType object that owns this object.
+     */
+    SimulationType* simulType;
+    /**
+     * @brief Indicates if the transient of the run ended.
+     */
+    bool steady;
+    /**
+     * @brief Indicates if the target precision is reached.
+     */
+    bool converged;
+    /**
+     * @brief Transient removal option of the run.
+     */
+    TransientOption transientOption;
+    /**
+     * @brief Number of requests of each batch.
+     */
+    double batchSize;
+    /**
+     * @brief Number of requests removed with the fixed transient removal.
+     */
+    double transientSize;
+    /**
+     * @brief Target of the confidence interval half-width, relative to the
+     * mean.
+     */
+    double precision;
+    /**
+     * @brief Number of evaluated requests at the start of the batch.
+     */
+    double batchStartReq;
+    /**
+     * @brief Number of blocked requests at the start of the batch.
+     */
+    double batchStartBloc;
+    /**
+     * @brief Blocking probability of each batch.
+     */
+    std::vector<double> batches;
+    /**
+     * @brief Sum of the blocking probabilities of the batches.
+     */
+    double sum;
+    /**
+     * @brief Sum of the squares of the blocking probabilities of the
+     * batches.
+     */
+    double sumSquares;
+    /**
+     * @brief Minimum number of batches for the MSER rule and the
+     * convergence.
+     */
+    static const unsigned int minNumBatches;
+};
+
+#endif /* STEADYSTATE_H */
+
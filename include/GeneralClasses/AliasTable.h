@@ -0,0 +1,64 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   AliasTable.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 8:00 PM
+ */
+
+#ifndef ALIASTABLE_H
+#define ALIASTABLE_H
+
+#include <vector>
+
+#include "RandomStreams.h"
+
+/**
+ * @brief Class AliasTable draws indexes of a discrete distribution with the
+ * alias method. The table is built by the Vose algorithm in linear time, and
+ * each draw takes one uniform index and one uniform real, however skewed
+ * the weights are.
+ */
+class AliasTable {
+public:
+    /**
+     * @brief Standard constructor of an empty AliasTable object.
+     */
+    AliasTable();
+
+    /**
+     * @brief Function to build the table of a set of weights. The weights do
+     * not need to be normalized.
+     * @param weights Positive weights.
+     */
+    void Create(const std::vector<double>& weights);
+    /**
+     * @brief Function to draw an index with probability proportional to its
+     * weight.
+     * @param engine Random engine.
+     * @return Drawn index.
+     */
+    unsigned int Draw(RandomStreams::Engine& engine) const;
+    /**
+     * @brief Function to get the number of indexes of the table.
+     * @return Number of indexes.
+     */
+    unsigned int GetSize() const;
+private:
+    /**
+     * @brief Probability of keeping each index, instead of its alias.
+     */
+    std::vector<double> probabilities;
+    /**
+     * @brief Alias of each index.
+     */
+    std::vector<unsigned int> aliases;
+};
+
+#endif /* ALIASTABLE_H */
+
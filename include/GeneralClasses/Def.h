@@ -47,11 +47,23 @@ typedef unsigned int NodeIndex;
 typedef unsigned int CoreIndex;
 typedef unsigned int SlotIndex;
 typedef unsigned int RouteIndex;
+typedef unsigned int EventIndex;
 
 typedef unsigned long long int NumRequest;
 
 /**
- * @brief Class responsible to define constants, random engines and other
+ * @brief Exit codes returned by the simulator.
+ */
+enum ExitCode{
+    ExitSuccess,
+    ExitInvalidArguments,
+    ExitInvalidBatch,
+    ExitMissingFile,
+    ExitSimulationError
+};
+
+/**
+ * @brief Class responsible to define constants and other
  * parameters.
  */
 class Def {
@@ -80,18 +92,6 @@ public:
      * @brief Define the maximum double value
      */
     static double Max_Double;
-    /**
-     * @brief Random device used in the engines to generate real random values.
-     */
-    static std::random_device randomDevice;
-    /**
-     * @brief Pseudo random engine.
-     */
-    static std::default_random_engine pseudoRandomEngine;
-    /**
-     * @brief Random engine.
-     */
-    static std::default_random_engine randomEngine;
 };
 
 #endif /* DEF_H */
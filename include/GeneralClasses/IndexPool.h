@@ -0,0 +1,84 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   IndexPool.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 8:20 PM
+ */
+
+#ifndef INDEXPOOL_H
+#define INDEXPOOL_H
+
+#include <vector>
+
+/**
+ * @brief Class IndexPool keeps a subset of the indexes 0 to size - 1, such as
+ * the free units of a device container. Insertion, removal, membership and
+ * size take constant time, and the members are stored contiguously, in no
+ * particular order.
+ */
+class IndexPool {
+public:
+    /**
+     * @brief Standard constructor of an empty IndexPool object.
+     */
+    IndexPool();
+
+    /**
+     * @brief Function to initialize the pool for a number of indexes.
+     * @param size Number of indexes.
+     * @param full True to insert all indexes, false to start empty.
+     */
+    void Initialize(unsigned int size, bool full);
+    /**
+     * @brief Function to insert an index that is not in the pool.
+     * @param index Index to insert.
+     */
+    void Insert(unsigned int index);
+    /**
+     * @brief Function to remove an index that is in the pool. The last member
+     * takes its position.
+     * @param index Index to remove.
+     */
+    void Remove(unsigned int index);
+    /**
+     * @brief Function to check if an index is in the pool.
+     * @param index Index to check.
+     * @return True if the index is in the pool.
+     */
+    bool Contains(unsigned int index) const;
+    /**
+     * @brief Function to get the number of indexes in the pool.
+     * @return Number of indexes.
+     */
+    unsigned int GetSize() const;
+    /**
+     * @brief Function to get the index stored in a position of the pool.
+     * @param position Position, smaller than the pool size.
+     * @return Index.
+     */
+    unsigned int GetIndex(unsigned int position) const;
+private:
+    /**
+     * @brief Indexes in the pool.
+     */
+    std::vector<unsigned int> indexes;
+    /**
+     * @brief Position of each index in the pool, or invalidPosition if the
+     * index is not in the pool.
+     */
+    std::vector<unsigned int> positions;
+
+    /**
+     * @brief Position of the indexes that are not in the pool.
+     */
+    static const unsigned int invalidPosition;
+};
+
+#endif /* INDEXPOOL_H */
+
@@ -0,0 +1,178 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   Profiler.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:44 PM
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <boost/unordered_map.hpp>
+#include <boost/assign/list_of.hpp>
+
+/**
+ * @brief Phases of the simulation timed by the profiler.
+ */
+enum ProfilePhase {
+    PhaseEventQueue,
+    PhaseRouting,
+    PhaseModulation,
+    PhaseOSNR,
+    PhaseSpecAllocRandom,
+    PhaseSpecAllocFF,
+    PhaseSpecAllocMSCL,
+    PhaseConnect,
+    PhaseRelease,
+    PhaseFragmentation,
+    PhaseStorageCall,
+    FirstProfilePhase = PhaseEventQueue,
+    LastProfilePhase = PhaseStorageCall
+};
+
+/**
+ * @brief Counters of the profiler.
+ */
+enum ProfileCounter {
+    CounterEvents,
+    CounterCandidateSlots,
+    FirstProfileCounter = CounterEvents,
+    LastProfileCounter = CounterCandidateSlots
+};
+
+//The profiler calls are compiled only with ONS_PROFILER, defined in the
+//debug builds or by the CMake option of the same name.
+#ifdef ONS_PROFILER
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(phase) \
+ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(phase)
+#define PROFILE_COUNT(counter, value) Profiler::Count(counter, value)
+#else
+#define PROFILE_SCOPE(phase)
+#define PROFILE_COUNT(counter, value)
+#endif
+
+/**
+ * @brief Class Profiler keeps the time spent in the main phases of the
+ * simulation and the hot path counters. Each thread accumulates its own
+ * values, added to the totals when the thread ends or when the report is
+ * made, so the parallel load points do not share counters. The profiler
+ * is enabled at runtime, and its calls are only compiled with
+ * ONS_PROFILER.
+ */
+class Profiler {
+public:
+    /**
+     * @brief Function to check if the profiler calls are compiled.
+     * @return True if ONS_PROFILER is defined.
+     */
+    static bool IsBuilt();
+    /**
+     * @brief Function to enable or disable the profiler.
+     * @param enabled True to enable the profiler.
+     */
+    static void SetEnabled(bool enabled);
+    /**
+     * @brief Function to check if the profiler is enabled.
+     * @return True if it is enabled.
+     */
+    static bool IsEnabled();
+    /**
+     * @brief Function to add a value to a counter of this thread.
+     * @param counter Profiler counter.
+     * @param value Value added.
+     */
+    static void Count(ProfileCounter counter, std::uint64_t value);
+    /**
+     * @brief Function to add the time of a phase to this thread.
+     * @param phase Profiler phase.
+     * @param nanoseconds Elapsed time.
+     */
+    static void AddTime(ProfilePhase phase, std::uint64_t nanoseconds);
+    /**
+     * @brief Function to discard all values and restart the wall clock of
+     * the report.
+     */
+    static void Reset();
+    /**
+     * @brief Function to print the events per second, the time per event
+     * of each phase and the counters. The times of nested phases are also
+     * included in the outer phases.
+     * @param ostream Output stream.
+     */
+    static void Report(std::ostream& ostream);
+private:
+    /**
+     * @brief Indicates if the profiler is enabled.
+     */
+    static bool enabled;
+    /**
+     * @brief Wall clock time of the last reset.
+     */
+    static std::chrono::steady_clock::time_point resetTime;
+    /**
+     * @brief Map the profiler phases and their respective names.
+     */
+    static const boost::unordered_map<ProfilePhase,
+    std::string> mapProfilePhase;
+    /**
+     * @brief Map the profiler counters and their respective names.
+     */
+    static const boost::unordered_map<ProfileCounter,
+    std::string> mapProfileCounter;
+};
+
+/**
+ * @brief Scoped timer of a profiler phase. The time between its
+ * construction and destruction is added to the phase.
+ */
+class ProfileScope {
+public:
+    /**
+     * @brief Standard constructor of a ProfileScope object.
+     * @param phase Profiler phase.
+     */
+    explicit ProfileScope(ProfilePhase phase)
+    :phase(phase), active(Profiler::IsEnabled()) {
+
+        if(active)
+            start = std::chrono::steady_clock::now();
+    }
+    /**
+     * @brief Destructor of a ProfileScope object.
+     */
+    ~ProfileScope() {
+
+        if(active)
+            Profiler::AddTime(phase, std::chrono::duration_cast<
+            std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+            start).count());
+    }
+private:
+    /**
+     * @brief Profiler phase.
+     */
+    ProfilePhase phase;
+    /**
+     * @brief Indicates if the profiler was enabled at the construction.
+     */
+    bool active;
+    /**
+     * @brief Time of the construction.
+     */
+    std::chrono::steady_clock::time_point start;
+};
+
+#endif /* PROFILER_H */
+
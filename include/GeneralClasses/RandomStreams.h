@@ -0,0 +1,145 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   RandomStreams.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 3:16 PM
+ */
+
+#ifndef RANDOMSTREAMS_H
+#define RANDOMSTREAMS_H
+
+#include <random>
+#include <vector>
+#include <cassert>
+
+class SimulationType;
+
+#include "Def.h"
+
+/**
+ * @brief Streams of random numbers used in a simulation. Each stream has 
+ * its own engine, so the use of one stream does not change the sequence of 
+ * the other ones.
+ */
+enum RandomStream {
+    StreamNodes,
+    StreamTraffic,
+    StreamArrival,
+    StreamHolding,
+    StreamProtection,
+    StreamSpecAlloc,
+    StreamRouting,
+    StreamGA,
+    StreamPSO,
+    FirstStream = StreamNodes,
+    LastSimulStream = StreamRouting,
+    LastStream = StreamPSO
+};
+
+/**
+ * @brief Class RandomStreams keeps the random engines of a simulation. The 
+ * streams from FirstStream to LastSimulStream are used by the simulation 
+ * runs, and can be restarted at each run. The other streams are used by 
+ * the optimization algorithms.
+ */
+class RandomStreams {
+public:
+    /**
+     * @brief Type of the random engine of each stream.
+     */
+    typedef std::mt19937 Engine;
+    
+    /**
+     * @brief Standard constructor of a RandomStreams object.
+     * @param simulType SimulationType object that owns these streams.
+     */
+    RandomStreams(SimulationType* simulType);
+    /**
+     * @brief Virtual destructor of a RandomStreams object.
+     */
+    virtual ~RandomStreams();
+    
+    /**
+     * @brief Function to define the seed of the streams, based on the
+     * random generation option.
+     */
+    void Load();
+    /**
+     * @brief Function to set the seed of the streams and restart all of them.
+     * @param seed Seed of the streams.
+     */
+    void SetSeed(unsigned int seed);
+    /**
+     * @brief Function to get the seed of the streams.
+     * @return Seed of the streams.
+     */
+    unsigned int GetSeed() const;
+    /**
+     * @brief Function to restart the streams used in the simulation runs. 
+     * Different indexes give independent sequences for the same seed.
+     * @param subIndex Index of the sequence.
+     */
+    void RestartSimulStreams(unsigned int subIndex);
+    /**
+     * @brief Function to set the replication index of the simulation. The 
+     * streams restarted afterwards give sequences independent of the other
+     * replications.
+     * @param replication Replication index.
+     */
+    void SetReplication(unsigned int replication);
+    /**
+     * @brief Function to get the replication index of the simulation.
+     * @return Replication index.
+     */
+    unsigned int GetReplication() const;
+    /**
+     * @brief Function to get the random engine of a specified stream.
+     * @param stream Random stream.
+     * @return Random engine.
+     */
+    Engine& GetEngine(RandomStream stream);
+    /**
+     * @brief Function to get the random engines of all streams, with their
+     * state.
+     * @return Container of random engines.
+     */
+    const std::vector<Engine>& GetEngines() const;
+    /**
+     * @brief Function to set the random engines of all streams.
+     * @param engines Container of random engines.
+     */
+    void SetEngines(const std::vector<Engine>& engines);
+private:
+    /**
+     * @brief Function to restart a specified stream.
+     * @param stream Random stream.
+     * @param subIndex Index of the sequence.
+     */
+    void RestartStream(RandomStream stream, unsigned int subIndex);
+private:
+    /**
+     * @brief Pointer to the SimulationType object that owns these streams.
+     */
+    SimulationType* simulType;
+    /**
+     * @brief Seed of the streams.
+     */
+    unsigned int seed;
+    /**
+     * @brief Replication index of the simulation.
+     */
+    unsigned int replication;
+    /**
+     * @brief Container of random engines, one for each stream.
+     */
+    std::vector<Engine> engines;
+};
+
+#endif /* RANDOMSTREAMS_H */
+
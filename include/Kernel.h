@@ -17,6 +17,8 @@
 #include <vector>
 #include <memory>
 #include <iostream>
+#include <string>
+#include <utility>
 #include <boost/assign/list_of.hpp>
 #include <boost/unordered_map.hpp>
 
@@ -60,11 +62,70 @@ public:
      * Three steps are done, each one for all simulation.
      */
     void Run();
+    /**
+     * @brief Runs the Kernel with the command line arguments. Without 
+     * arguments, the simulations are read from the terminal. Otherwise the
+     * simulations are taken from the arguments and batch files, and the
+     * simulator does not wait for the user. An error of a simulation ends
+     * the simulator with the simulation error exit code.
+     * @param argc Number of arguments.
+     * @param argv Arguments.
+     * @return Exit code of the simulator.
+     */
+    int Run(int argc, char** argv);
     /**
      * @brief Function to create all simulation of this kernel.
      */
     void CreateSimulations();
+    /**
+     * @brief Function to print the command line usage of the simulator.
+     * @param ostream Output stream.
+     * @return Output stream.
+     */
+    static std::ostream& Help(std::ostream& ostream);
 private:
+    /**
+     * @brief Runs the Kernel with the command line arguments, without
+     * handling the errors of the simulations.
+     * @param argc Number of arguments.
+     * @param argv Arguments.
+     * @return Exit code of the simulator.
+     */
+    ExitCode RunArguments(int argc, char** argv);
+    /**
+     * @brief Runs the three steps of all simulations created.
+     */
+    void RunSimulations();
+    /**
+     * @brief Function to read the command line arguments.
+     * @param argc Number of arguments.
+     * @param argv Arguments.
+     * @return ExitSuccess if the arguments are valid.
+     */
+    ExitCode ReadArguments(int argc, char** argv);
+    /**
+     * @brief Function to read the simulations of a batch file. Each 
+     * simulation starts with a [simulation] section, followed by the 
+     * 'type' and, optionally, the 'index' keys.
+     * @param fileName Name of the batch file.
+     * @return ExitSuccess if the file is valid.
+     */
+    ExitCode ReadBatchFile(const std::string& fileName);
+    /**
+     * @brief Function to add a simulation to the batch, checking its type
+     * and index.
+     * @param index Simulation index. Zero to use the batch position.
+     * @param type Simulation type.
+     * @return True if the simulation is valid.
+     */
+    bool AddBatchSimulation(SimulIndex index, unsigned int type);
+    /**
+     * @brief Check if the parameters and options files of a simulation 
+     * exist.
+     * @param index Simulation index.
+     * @return True if all files exist.
+     */
+    static bool CheckSimulationFiles(SimulIndex index);
     /**
      * @brief Function to apply the pre-simulation for a specified simulation
      * object.
@@ -96,6 +157,14 @@ private:
      * @brief Vector with all pointers to SimulationType objects.
      */
     std::vector<std::shared_ptr<SimulationType>> simulations;
+    /**
+     * @brief Index and type of the simulations given by the command line.
+     */
+    std::vector<std::pair<SimulIndex, TypeSimulation>> batchSimulations;
+    /**
+     * @brief Indicates if the command line asked for the usage.
+     */
+    bool helpRequested;
     /**
      * @brief Map the types of simulations and their respective names.
      */
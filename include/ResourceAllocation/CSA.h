@@ -20,23 +20,26 @@ class CSA: public SA {
 public:
     CSA(ResourceAlloc* rsa, SpectrumAllocationOption option, 
         Topology* topology);
-    /**
-     * @brief Spectrum allocation that chooses first core and first set of slots
-     * available to allocate the call
-     * @param call
-     */    
+    
     virtual ~CSA();
     
     
     void SpecAllocation(Call* call) override;
-
-    void FirstFit(Call* call);        
     /**
-     * @brief Return strong call class pointer to cast
-     * @param call pointer of call class
-     * @return Call pointer
-     */    
-    void MSCL(Call* call);
+     * @brief Spectrum allocation that chooses first core and first set of slots
+     * available to allocate the call. The availability masks of all cores 
+     * are obtained in a single pass over the route links.
+     * @param call Call request.
+     */
+    void FirstFit(Call* call) override;
+    /**
+     * @brief Function to apply the MSCL spectral allocation in all cores. 
+     * Selects the core and set of slots with minimum loss of capacity of the 
+     * call route and its interfering routes in the same core. The first 
+     * option, by core and later slot, wins the ties.
+     * @param call Call request.
+     */
+    void MSCL(Call* call) override;
 private:
     
 };
@@ -18,6 +18,7 @@ class ResourceAlloc;
 class Call;
 class CallDevices;
 
+#include <vector>
 #include <boost/assign/list_of.hpp>
 #include <boost/unordered_map.hpp>
 
@@ -36,6 +37,24 @@ enum TypeModulation{
     FixedModulation = QAM_4
 };
 
+/**
+ * @brief Parameters of a demand, for a modulation format and a bit rate.
+ */
+struct DemandParam {
+    /**
+     * @brief Number of slots, including the guard band.
+     */
+    unsigned int numSlots;
+    /**
+     * @brief Spectral bandwidth.
+     */
+    double bandwidth;
+    /**
+     * @brief OSNR threshold.
+     */
+    double osnrTh;
+};
+
 /**
  * @brief Class responsible to calculate the call requests parameters based in
  * its modulation format.
@@ -66,6 +85,21 @@ public:
      * @param call Call request to be analyzed.
      */
     void SetModulationParam(CallDevices* call);
+    /**
+     * @brief Creates the table of demand parameters of all modulation 
+     * formats and bit rates of the traffic. The parameters of other bit 
+     * rates are calculated when requested.
+     * @param bitRates Container with all possible traffics.
+     */
+    void CreateDemandTable(const std::vector<double>& bitRates);
+    /**
+     * @brief Gets the parameters of a demand, from the demand table if its
+     * bit rate is one of the traffic.
+     * @param modulation Modulation format.
+     * @param bitRate Bit rate.
+     * @return Parameters of the demand.
+     */
+    DemandParam GetDemandParam(TypeModulation modulation, double bitRate);
     /**
      * @brief Gets the possible slots set that the call requests can use.
      * @param traffic Container with all possible traffics.
@@ -137,6 +171,13 @@ private:
     std::vector<unsigned int> GetPossibleSlotsVariableMod(std::vector<double>&
                                                           traffic);
     static unsigned int GetNumBits(TypeModulation modulation);
+    /**
+     * @brief Calculates the parameters of a demand.
+     * @param modulation Modulation format.
+     * @param bitRate Bit rate.
+     * @return Parameters of the demand.
+     */
+    DemandParam CalcDemandParam(TypeModulation modulation, double bitRate);
 private:
     /**
      * @brief ResouseAlloc object that owns the modulation object.
@@ -164,6 +205,15 @@ private:
      */
     static const boost::unordered_map<TypeModulation, 
                                       unsigned int> mapNumBitsModulation;
+    /**
+     * @brief Bit rates of the demand table.
+     */
+    std::vector<double> demandBitRates;
+    /**
+     * @brief Demand parameters of each modulation format and bit rate of the
+     * traffic, indexed by the modulation format and the bit rate position.
+     */
+    std::vector<std::vector<DemandParam>> demandTable;
 };
 
 #endif /* MODULATION_H */
@@ -0,0 +1,121 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/* 
+ * File:   MultiPathAlloc.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 7:11 PM
+ */
+
+#ifndef MULTIPATHALLOC_H
+#define MULTIPATHALLOC_H
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "../../GeneralClasses/Def.h"
+
+class ResourceAlloc;
+class CallDevices;
+class Route;
+
+/**
+ * @brief Allocation found for a call with a working path and protection 
+ * paths.
+ */
+struct MultiPathSolution {
+    /**
+     * @brief Index of the working route in the trial routes of the call.
+     */
+    unsigned int routeIndex;
+    /**
+     * @brief Indexes of the protection routes in the trial protection routes
+     * of the working route.
+     */
+    std::vector<unsigned int> protRouteIndexes;
+    /**
+     * @brief First slot of each path, the working path first.
+     */
+    std::vector<SlotIndex> firstSlots;
+};
+
+/**
+ * @brief Class MultiPathAlloc searches the spectrum of a working path and one
+ * or two protection paths, in the order of the nested loops of the 
+ * spectrum-routing protection schemes: the possible first slots of the 
+ * working path, the working routes, and then the slots and routes of each 
+ * protection path. The feasible first slots of each route are taken once 
+ * from its slots mask. Since the availability of a path does not depend on 
+ * the slots of the other paths, the protection paths are searched once for 
+ * each working route, instead of once for each slot of the working path.
+ */
+class MultiPathAlloc {
+public:
+    /**
+     * @brief Standard constructor of a MultiPathAlloc object.
+     * @param resourceAlloc Resource allocation that owns the routes.
+     */
+    MultiPathAlloc(ResourceAlloc* resourceAlloc);
+    /**
+     * @brief Virtual destructor of a MultiPathAlloc object.
+     */
+    virtual ~MultiPathAlloc();
+    
+    /**
+     * @brief Function to find the first allocation of a call in one of its 
+     * working routes and one or two protection routes of it. The protection
+     * routes of a path are different, and null routes are skipped.
+     * @param call Call with the trial working and protection routes.
+     * @param numSlots Number of slots of each path, the working path first.
+     * @param possibleSlots Possible first slots, in the order they are 
+     * tried.
+     * @param solution Allocation found.
+     * @return True if an allocation was found.
+     */
+    bool FindFirst(CallDevices* call, const std::vector<unsigned int>& 
+    numSlots, const std::vector<unsigned int>& possibleSlots, 
+    MultiPathSolution& solution);
+private:
+    /**
+     * @brief Function to find the protection paths of a working route.
+     * @param call Call with the trial working and protection routes.
+     * @param numSlots Number of slots of each path, the working path first.
+     * @param possibleSlots Possible first slots, in the order they are 
+     * tried.
+     * @param solution Allocation, with the working route index set.
+     * @return True if the protection paths were found.
+     */
+    bool FindProtection(CallDevices* call, const std::vector<unsigned int>& 
+    numSlots, const std::vector<unsigned int>& possibleSlots, 
+    MultiPathSolution& solution);
+    /**
+     * @brief Function to get the index of the first possible slot that 
+     * starts a block of free slots in a route.
+     * @param route Route.
+     * @param numSlots Number of slots of the block.
+     * @param possibleSlots Possible first slots, in the order they are 
+     * tried.
+     * @return Index in the possible slots, or Def::Max_UnInt if there is no
+     * block.
+     */
+    unsigned int FindFirstIndex(Route* route, unsigned int numSlots,
+    const std::vector<unsigned int>& possibleSlots);
+private:
+    /**
+     * @brief Resource allocation that owns the routes.
+     */
+    ResourceAlloc* resourceAlloc;
+    /**
+     * @brief First slot indexes already found in the actual search, for each
+     * route and number of slots.
+     */
+    std::map<std::pair<Route*, unsigned int>, unsigned int> firstIndexes;
+};
+
+#endif /* MULTIPATHALLOC_H */
+
@@ -25,6 +25,7 @@ class ResourceDeviceAlloc;
 #include "../ResourceDeviceAlloc.h"
 #include "../../Data/Parameters.h"
 #include "../Modulation.h"
+#include "MultiPathAlloc.h"
 
 class ProtectionScheme {
 public:
@@ -58,6 +59,32 @@ public:
     void CalcAlpha(CallDevices* call);
           
 protected:
+    /**
+     * @brief Function which allocates the working and protection paths of a 
+     * call in the first set of routes and slots found by the multi-path 
+     * search, with the fixed modulation. If found, the call is accepted as a
+     * protected call.
+     * @param call Call with the trial working and protection routes.
+     * @param pathCalls Calls of the working path (first position) and of 
+     * the protection paths.
+     * @param possibleSlots Possible first slots, in the order they are 
+     * tried.
+     * @return True if the call was allocated.
+     */
+    bool AllocateMultiPath(CallDevices* call, 
+    const std::vector<std::shared_ptr<Call>>& pathCalls, 
+    const std::vector<unsigned int>& possibleSlots);
+    /**
+     * @brief Function which sets the paths of a blocked call in its last 
+     * trial route and protection routes, so the slots of all paths are 
+     * counted as blocked.
+     * @param call Blocked call.
+     * @param pathCalls Calls of the working path (first position) and of 
+     * the protection paths.
+     */
+    void SetBlockedPaths(CallDevices* call, 
+    const std::vector<std::shared_ptr<Call>>& pathCalls);
+
     ResourceDeviceAlloc* resDevAlloc;
     Resources* resources;
     Topology* topology;
@@ -76,6 +103,11 @@ protected:
      * Used if the simulation make use of protection. 
      */
     std::vector<std::shared_ptr<Call>> protectionCalls;
+    /**
+     * @brief Search of the working and protection paths of the 
+     * spectrum-routing allocations.
+     */
+    std::unique_ptr<MultiPathAlloc> multiPathAlloc;
 
     
 private:
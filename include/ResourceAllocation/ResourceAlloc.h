@@ -17,6 +17,7 @@
 #include <vector>
 #include <memory>
 #include <cassert>
+#include <unordered_set>
 
 class SimulationType;
 class Topology;
@@ -28,7 +29,9 @@ class Call;
 class Modulation;
 class Traffic;
 class Resources;
+class ResourcesCache;
 class Parameters;
+class SlotMask;
 
 #include "../Data/Options.h"
 #include "../GeneralClasses/Def.h"
@@ -162,6 +165,22 @@ public:
      * @return Resource pointer.
      */
     Resources* GetResources() const;
+    /**
+     * @brief Function to get the offline tables cache pointer.
+     * @return Offline tables cache pointer. Null if the cache is disabled.
+     */
+    ResourcesCache* GetResourcesCache() const;
+    /**
+     * @brief Function to check if the offline tables of the resources were
+     * loaded from the cache.
+     * @return True if the tables were loaded from the cache.
+     */
+    bool IsResourcesCacheLoaded() const;
+    /**
+     * @brief Function to save the offline tables of the resources in the 
+     * cache, if it is enabled and they were not loaded from it.
+     */
+    void SaveResourcesCache();
     /**
      * @brief Function to get the modulation pointer.
      * @return Modulation pointer.
@@ -228,24 +247,26 @@ public:
      * @param pos Route index of the node pair.
      * @return Interfering routes.
      */
-    std::vector<std::shared_ptr<Route>> GetInterRoutes(int ori, int des, 
-                                                       int pos);
+    const std::vector<std::shared_ptr<Route>>& GetInterRoutes(int ori, 
+    int des, int pos) const;
     /**
      * @brief Gets the container of interfering routes of a specified node pair 
      * and route of this pair.
      * @param orNode Source node index.
      * @param deNode Destination node index.
      * @param route Route that determine the index of the node pair.
-     * @return Interfering routes.
+     * @return Interfering routes. Empty if the route is not one of the node
+     * pair routes.
      */
-    std::vector<std::shared_ptr<Route>> GetInterRoutes(unsigned int orNode,
-    unsigned int deNode, Route* route);
+    const std::vector<std::shared_ptr<Route>>& GetInterRoutes(
+    unsigned int orNode, unsigned int deNode, Route* route) const;
     /**
      * @brief Gets the container of number of interfering routes the MSCL 
      * will check for all node pair and routes in the network.
      * @return Container of number of interfering routes to check.
      */
-    std::vector<std::vector<unsigned int>> GetNumInterRoutesToCheck();
+    const std::vector<std::vector<unsigned int>>& GetNumInterRoutesToCheck()
+    const;
     /**
      * @brief Gets the number of interfering routes to check for an specified 
      * node pair and position. Used for MSCL SA algorithm.
@@ -276,7 +297,7 @@ public:
      * call requests.
      * @return Container of number of slots.
      */
-    std::vector<unsigned int> GetNumSlotsTraffic() const;
+    const std::vector<unsigned int>& GetNumSlotsTraffic() const;
     /**
      * @brief Function to set the container with the possible number of slots
      * a connection request could have.
@@ -288,6 +309,22 @@ public:
      * @return Container of slots state.
      */
     std::vector<SlotState> GetDispVector(Route* route) const;
+    /**
+     * @brief Function to get the availability mask of a specified route, in a 
+     * specified core. A slot is set in the mask if it is free in all route 
+     * links.
+     * @param route Specified route.
+     * @param core Core index.
+     * @return Availability mask.
+     */
+    SlotMask GetDispMask(Route* route, CoreIndex core) const;
+    /**
+     * @brief Function to get the availability masks of a specified route in 
+     * all cores, with a single pass over the route links.
+     * @param route Specified route.
+     * @return Availability masks, indexed by core.
+     */
+    std::vector<SlotMask> GetDispMasks(Route* route) const;
     /**
      * @brief Function to calculate the number of forms of a call request number
      * of slots in a specified availability vector.
@@ -324,6 +361,17 @@ public:
     std::vector<unsigned int> GetBlocksFreeSlots(unsigned int callSize,
     std::vector<SlotState>& dispVec) const;
 private:
+    /**
+     * @brief Set the interfering routes of the routes of a node pair, from
+     * the routes that use each link of the network.
+     * @param pairIndex Node pair index.
+     * @param linkRoutes Routes that use each link, indexed by the link 
+     * nodes pair.
+     * @param addedRoutes Auxiliary set of routes already added.
+     */
+    void SetInterferingRoutes(unsigned int pairIndex, 
+    const std::vector<std::vector<std::shared_ptr<Route>>>& linkRoutes, 
+    std::unordered_set<Route*>& addedRoutes);
     /**
      * @brief Function to apply resource allocation without modulation 
      * variation. The RSA order will be determined by the vector 
@@ -464,6 +512,10 @@ public:
      * @brief Resource object owned by the object.
      */
     std::shared_ptr<Resources> resources;
+    /**
+     * @brief Offline tables cache owned by this object.
+     */
+    std::shared_ptr<ResourcesCache> resourcesCache;
     /**
      * @brief Route object owned by this object.
      */
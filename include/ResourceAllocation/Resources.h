@@ -101,8 +101,9 @@ public:
      * @param deN Destination node.
      * @return Vector of routes.
      */
-    std::vector<std::shared_ptr<Route>> GetRoutes(unsigned int orN,
-                                                  unsigned int deN);
+    const std::vector<std::shared_ptr<Route>>& GetRoutes(unsigned int orN,
+                                                         unsigned int deN) 
+                                                         const;
     /**
      * @brief Function that returns a container of protection routes of a 
      * specified working route of a node pair.
@@ -111,16 +112,16 @@ public:
      * @param route
      * @return Vector of routes.
      */
-    std::vector<std::shared_ptr<Route>> GetProtRoutes(unsigned int orN,
-                                                  unsigned int deN,
-                                                  unsigned int route);
+    const std::vector<std::shared_ptr<Route>>& GetProtRoutes(
+    unsigned int orN, unsigned int deN, unsigned int route) const;
     
     /**
      * @brief Function to get the container of routes of all network node
      * pairs.
      * @return Container with all routes.
      */
-    std::vector<std::vector<std::shared_ptr<Route>>> GetRoutes() const;
+    const std::vector<std::vector<std::shared_ptr<Route>>>& GetRoutes() 
+    const;
     /**
      * @brief Function to get the container of routes of all network node
      * pairs.
@@ -142,7 +143,7 @@ public:
      * @param call Call request.
      * @return Container with the number of regenerators.
      */
-    std::vector<std::vector<unsigned>> GetNumberRegSet(Call* call);
+    const std::vector<std::vector<unsigned>>& GetNumberRegSet(Call* call);
     /**
      * @brief Function to get the container with the number of slots used by 
      * each possible route and each regeneration combination of those routes
@@ -150,7 +151,7 @@ public:
      * @param call Call request.
      * @return Container with the number of slots.
      */
-    std::vector<std::vector<unsigned>> GetNumberSlotsSet(Call* call);
+    const std::vector<std::vector<unsigned>>& GetNumberSlotsSet(Call* call);
     /**
      * @brief Function to get the number of regeneratos for a specified call
      * request (With predefined bit rate and node pairs), a route index and a
@@ -182,7 +183,7 @@ public:
      * @param subRouteIndex Regeneration option index.
      * @return Container with the number of slots per transparent segment.
      */
-    std::vector<unsigned> GetNumSlotsPerTranspSegments(Call* call, 
+    const std::vector<unsigned>& GetNumSlotsPerTranspSegments(Call* call, 
     unsigned routeIndex, unsigned subRouteIndex);
     /**
      * @brief Function to get the routes of the transparent segments that 
@@ -192,8 +193,8 @@ public:
      * @param subRouteIndex Regeneration option index.
      * @return Container of routes of each transparent segment.
      */
-    std::vector<std::shared_ptr<Route>> GetRoutesTranspSegments(Call* call, 
-    unsigned int subRouteIndex);
+    const std::vector<std::shared_ptr<Route>>& GetRoutesTranspSegments(
+    Call* call, unsigned int subRouteIndex);
     /**
      * @brief Function to get the routes of the transparent segments that 
      * compose the total route for a specified call request (With predefined 
@@ -203,10 +204,10 @@ public:
      * @param subRouteIndex Regeneration option index.
      * @return Container of routes of each transparent segment.
      */
-    std::vector<std::shared_ptr<Route>> GetRoutesTranspSegments(Call* call, 
-    unsigned int routeIndex, unsigned int subRouteIndex);
+    const std::vector<std::shared_ptr<Route>>& GetRoutesTranspSegments(
+    Call* call, unsigned int routeIndex, unsigned int subRouteIndex);
     
-    std::vector<std::vector<std::vector<std::shared_ptr<Route>>>> 
+    const std::vector<std::vector<std::vector<std::shared_ptr<Route>>>>& 
     GetRoutesTranspSegments(Call* call);
     /**
      * @brief Function to get the modulation formats of each transparent segment
@@ -216,13 +217,13 @@ public:
      * @param subRouteIndex Regeneration option index.
      * @return Container of modulation formats.
      */
-    std::vector<TypeModulation> GetTranspSegmentsModulation(Call* call,
-                                                unsigned int subRouteIndex);
+    const std::vector<TypeModulation>& GetTranspSegmentsModulation(
+    Call* call, unsigned int subRouteIndex);
     
-    std::vector<std::vector<std::vector<TypeModulation>>> 
+    const std::vector<std::vector<std::vector<TypeModulation>>>& 
     GetSetsTranpSegmentsModulation(Call* call);
     
-    std::vector<std::vector<std::vector<unsigned  int>>>
+    const std::vector<std::vector<std::vector<unsigned  int>>>&
     GetSetsTranspSegmentsNumSlots(Call* call);
 private:
     /**
@@ -0,0 +1,187 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   ResourcesCache.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:10 PM
+ */
+
+#ifndef RESOURCESCACHE_H
+#define RESOURCESCACHE_H
+
+#include <vector>
+#include <memory>
+#include <string>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+
+class ResourceAlloc;
+class Route;
+
+#include "Modulation.h"
+
+/**
+ * @brief Class responsible for keeping the offline tables of the Resources
+ * (routes, protection routes, interfering routes, transparent segments and
+ * offline modulation formats) in a binary file. The file is identified by a
+ * key computed from the topology file, the traffic and the options and
+ * parameters these tables depend on, so later simulations with the same
+ * network load the tables instead of computing them.
+ */
+class ResourcesCache {
+public:
+    /**
+     * @brief Standard constructor of ResourcesCache class.
+     * @param resourceAlloc ResourceAlloc object that owns this cache.
+     */
+    ResourcesCache(ResourceAlloc* resourceAlloc);
+    /**
+     * @brief Standard destructor of ResourcesCache class.
+     */
+    virtual ~ResourcesCache();
+
+    /**
+     * @brief Function to load the cached tables into the Resources of the
+     * simulation. The Resources are not changed if the file does not exist
+     * or it is invalid.
+     * @return True if the tables were loaded.
+     */
+    bool Load();
+    /**
+     * @brief Function to save the tables of the Resources of the simulation.
+     * Nothing is done if the tables were loaded from the cache. The file is
+     * written with a temporary name and renamed, so simulations running at
+     * the same time never read a partial file.
+     */
+    void Save();
+    /**
+     * @brief Function to check if the tables were loaded from the cache.
+     * @return True if the tables were loaded.
+     */
+    bool IsLoaded() const;
+    /**
+     * @brief Function to check if the offline routing option of the
+     * simulation can be cached. Routings that depend on simulation results,
+     * such as BSR, are not cached.
+     * @return True if the routing can be cached.
+     */
+    bool IsCacheableRouting() const;
+private:
+    /**
+     * @brief Function to create the key of the cache file of this simulation.
+     */
+    void CreateKey();
+    /**
+     * @brief Function to add a block of bytes to the key.
+     * @param data Pointer to the bytes.
+     * @param size Number of bytes.
+     */
+    void AddToKey(const void* data, std::size_t size);
+    /**
+     * @brief Function to add a value to the key.
+     * @param value Value.
+     */
+    template <typename T> void AddToKey(const T& value);
+
+    /**
+     * @brief Function to write an integer value in the file.
+     * @param file Cache file.
+     * @param value Value.
+     */
+    void Write(std::ostream& file, std::uint32_t value) const;
+    /**
+     * @brief Function to write a modulation format in the file.
+     * @param file Cache file.
+     * @param mod Modulation format.
+     */
+    void Write(std::ostream& file, TypeModulation mod) const;
+    /**
+     * @brief Function to write a route in the file. Routes of the container
+     * of all routes are written by their indexes, the others by their paths.
+     * @param file Cache file.
+     * @param route Route, which may be null.
+     */
+    void Write(std::ostream& file, const std::shared_ptr<Route>& route) const;
+    /**
+     * @brief Function to write a container in the file, with its size
+     * followed by its elements.
+     * @param file Cache file.
+     * @param vec Container.
+     */
+    template <typename T> void Write(std::ostream& file,
+                                     const std::vector<T>& vec) const;
+
+    /**
+     * @brief Function to read an integer value from the file buffer.
+     * @param value Value read.
+     * @return False if the buffer has ended.
+     */
+    bool Read(std::uint32_t& value);
+    /**
+     * @brief Function to read a modulation format from the file buffer.
+     * @param mod Modulation format read.
+     * @return False if the buffer has ended or the value is invalid.
+     */
+    bool Read(TypeModulation& mod);
+    /**
+     * @brief Function to read a route from the file buffer.
+     * @param route Route read, which may be null.
+     * @return False if the buffer has ended or the route is invalid.
+     */
+    bool Read(std::shared_ptr<Route>& route);
+    /**
+     * @brief Function to read a container from the file buffer.
+     * @param vec Container read.
+     * @return False if the buffer has ended or an element is invalid.
+     */
+    template <typename T> bool Read(std::vector<T>& vec);
+private:
+    /**
+     * @brief ResourceAlloc object that owns this cache.
+     */
+    ResourceAlloc* resourceAlloc;
+    /**
+     * @brief Hexadecimal key of the cache file of this simulation.
+     */
+    std::string key;
+    /**
+     * @brief Numeric value of the key, also kept in the file header.
+     */
+    std::uint64_t keyValue;
+    /**
+     * @brief Indicates if the tables were loaded from the cache.
+     */
+    bool loaded;
+    /**
+     * @brief Content of the cache file being read.
+     */
+    std::string buffer;
+    /**
+     * @brief Position of the next value to be read from the buffer.
+     */
+    std::size_t position;
+    /**
+     * @brief Container of all routes being read, used to resolve the routes
+     * written by their indexes.
+     */
+    std::vector<std::vector<std::shared_ptr<Route>>> allRoutes;
+    /**
+     * @brief Node pair and route indexes of the routes of the container of
+     * all routes, used when writing the file.
+     */
+    std::unordered_map<const Route*, std::pair<std::uint32_t, std::uint32_t>>
+    routeIndexes;
+    /**
+     * @brief Version of the cache file format. Files of other versions are
+     * ignored.
+     */
+    static const std::uint32_t version;
+};
+
+#endif /* RESOURCESCACHE_H */
@@ -122,6 +122,13 @@ public:
      * the cost of links that compose the route.
      */
     void SetCost();
+    /**
+     * @brief Get the OSNR(dB) of a signal at the end of this route. The OSNR
+     * is calculated in the first call and kept, since the link physical 
+     * parameters do not change during the simulation.
+     * @return Route OSNR.
+     */
+    double GetOSNR() const;
     /**
      * @brief Function that return a specified link of this route.
      * @param index Link index.
@@ -192,6 +199,14 @@ private:
      * @brief Cost of the route.
      */
     double cost;
+    /**
+     * @brief OSNR(dB) of a signal at the end of this route.
+     */
+    mutable double osnr;
+    /**
+     * @brief Indicates if the route OSNR was already calculated.
+     */
+    mutable bool osnrCalculated;
 };
 
 #endif /* ROUTE_H */
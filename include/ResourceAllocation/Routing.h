@@ -15,11 +15,13 @@
 #define ROUTING_H
 
 #include <memory>
+#include <vector>
 
 class ResourceAlloc;
 class Call;
 class Route;
 class Topology;
+class Link;
 class Data;
 class Parameters;
 
@@ -64,7 +66,8 @@ public:
     virtual ~Routing();
     
     /**
-     * Function to load several routing parameters.
+     * Function to load several routing parameters, and the output links of
+     * each topology node used by the shortest path algorithms.
      */
     void Load();
     /**
@@ -81,7 +84,9 @@ public:
     
     /**
      * @brief Dijkstra(shortest path) routing algorithm for all 
-     * source/destination node pairs in the topology used.
+     * source/destination node pairs in the topology used. Each source node 
+     * runs a single shortest path tree, and the source nodes are divided 
+     * among threads.
      */
     void Dijkstra();
     /**
@@ -94,12 +99,15 @@ public:
     std::shared_ptr<Route> Dijkstra(NodeIndex orNode, NodeIndex deNode);
     /**
      * @brief YEN(k-shortest path) routing algorithm for all source/destination 
-     * node pairs in the topology used.
+     * node pairs in the topology used. The source nodes are divided among 
+     * threads.
      */
     void YEN();
     /**
      * @brief YEN routing algorithm for an especified source/destination 
-     * node pairs in the topology used.
+     * node pairs in the topology used. The links and nodes removed for each
+     * spur path are kept in local containers, so the topology is not changed
+     * and different node pairs can be calculated at the same time.
      * @param orNode Source node Id.
      * @param deNode Destination node Id.
      * @return Routes of this node pair.
@@ -230,6 +238,45 @@ private:
      * @param K Number of routes.
      */
     void SetK(unsigned int K);
+    /**
+     * @brief Dijkstra algorithm with a binary heap, from a source node until 
+     * the destination node is reached, or for all nodes if the destination is
+     * the number of nodes. The nodes are reached in the same order of the 
+     * array based version, smaller cost and then smaller index, and no route
+     * is found after a node without working output links is reached.
+     * @param orNode Source node Id.
+     * @param deNode Destination node Id.
+     * @param removedLinks Links removed from the topology, indexed by source 
+     * and destination node pair. Empty if no link is removed.
+     * @param removedNodes Nodes removed from the topology. Empty if no node is
+     * removed.
+     * @param precedent Container with the previous node of each node in the
+     * shortest path tree.
+     * @param reached Container that indicates the nodes that have a route.
+     */
+    void Dijkstra(NodeIndex orNode, NodeIndex deNode, 
+    const std::vector<bool>& removedLinks, 
+    const std::vector<bool>& removedNodes, std::vector<int>& precedent, 
+    std::vector<bool>& reached) const;
+    /**
+     * @brief Checks if a link can be used by the shortest path algorithms.
+     * @param link Link to check.
+     * @param removedLinks Links removed from the topology.
+     * @param removedNodes Nodes removed from the topology.
+     * @return True if the link, its source and destination nodes are working
+     * and not removed.
+     */
+    bool IsLinkUsable(const Link* link, const std::vector<bool>& removedLinks, 
+    const std::vector<bool>& removedNodes) const;
+    /**
+     * @brief Creates the route of a node pair from a shortest path tree.
+     * @param orNode Source node Id.
+     * @param deNode Destination node Id.
+     * @param precedent Previous node of each node in the shortest path tree.
+     * @return Created route.
+     */
+    std::shared_ptr<Route> CreateRoute(NodeIndex orNode, NodeIndex deNode, 
+    const std::vector<int>& precedent) const;
 
 
 private:
@@ -262,6 +309,10 @@ private:
      * @brief Number of routes for the k-shortest path algorithms.
      */
     unsigned int K;
+    /**
+     * @brief Output links of each topology node.
+     */
+    std::vector<std::vector<Link*>> outputLinks;
 };
 
 #endif /* ROUTING_H */
@@ -16,13 +16,16 @@
 
 #include <random>
 #include <cstdlib>
+#include <vector>
 
 class ResourceAlloc;
 class Topology;
 class Call;
 class CallDevices;
+class SlotMask;
 
 #include "../Data/Options.h"
+#include "../GeneralClasses/Def.h"
 
 /**
  * @brief Class responsible for spectral allocation of the call requests.
@@ -98,8 +101,6 @@ public:
      * @return ResourceAlloc pointer.
      */
     ResourceAlloc* GetResourceAlloc();
-    
-    int CalcNumFormAloc(int L, bool* Disp, int tam);
 private:
     /**
      * @brief Gets the vector with all possible first slots for spectrum
@@ -122,6 +123,28 @@ private:
      */
     std::vector<unsigned int> FirstFitSlots(Call* call);
 protected:
+    /**
+     * @brief Function to calculate the capacity loss of a route, in number of
+     * allocation forms of the traffic classes, if a range of slots is 
+     * occupied. Only the free blocks touched by the range are evaluated.
+     * @param dispMask Mask of free slots of the route.
+     * @param firstSlot First slot of the range.
+     * @param lastSlot Last slot of the range.
+     * @param vecTrafficSlots Number of slots of each traffic class.
+     * @return Number of allocation forms lost.
+     */
+    unsigned int CalcCapacityLoss(const SlotMask& dispMask, SlotIndex firstSlot,
+    SlotIndex lastSlot, const std::vector<unsigned int>& vecTrafficSlots) 
+    const;
+    /**
+     * @brief Function to calculate the number of allocation forms of the 
+     * traffic classes in a block of free slots.
+     * @param sizeBlock Number of slots of the block.
+     * @param vecTrafficSlots Number of slots of each traffic class.
+     * @return Number of allocation forms.
+     */
+    unsigned int CalcNumForms(unsigned int sizeBlock, 
+    const std::vector<unsigned int>& vecTrafficSlots) const;
     /**
      * @brief RourceAlloc that own this object.
      */
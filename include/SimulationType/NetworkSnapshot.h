@@ -0,0 +1,134 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   NetworkSnapshot.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:25 PM
+ */
+
+#ifndef NETWORKSNAPSHOT_H
+#define NETWORKSNAPSHOT_H
+
+#include <memory>
+#include <vector>
+#include <utility>
+
+class SimulationType;
+class Call;
+
+#include "../Structure/Core.h"
+#include "../Structure/Devices/Regenerator.h"
+#include "../Structure/Devices/SBVT_TSS_ML.h"
+#include "../GeneralClasses/RandomStreams.h"
+#include "../GeneralClasses/Def.h"
+
+/**
+ * @brief Class NetworkSnapshot keeps the state of the network of a
+ * simulation in a given time: the slots of all cores, the devices of the
+ * nodes, the calls in progress with the times of their ends, the simulation
+ * time and the random streams. The runs of the simulation can start from
+ * this state instead of an empty network. The calls are shared with the
+ * simulation, so the snapshot is only restored in the simulation that
+ * saved it.
+ */
+class NetworkSnapshot {
+public:
+    /**
+     * @brief Standard constructor of a NetworkSnapshot object.
+     * @param simulType SimulationType object that owns this snapshot.
+     */
+    NetworkSnapshot(SimulationType* simulType);
+    /**
+     * @brief Virtual destructor of a NetworkSnapshot object.
+     */
+    virtual ~NetworkSnapshot();
+
+    /**
+     * @brief Function to save the current state of the network of the
+     * simulation.
+     */
+    void Save();
+    /**
+     * @brief Function to restore the saved state in the network of the
+     * simulation. The random streams are restored only when each run would
+     * restart them with the same sequence, so the runs that should have
+     * independent sequences keep them.
+     */
+    void Restore() const;
+    /**
+     * @brief Function to discard the saved state.
+     */
+    void Clear();
+    /**
+     * @brief Function to check if there is a saved state.
+     * @return True if the state is saved.
+     */
+    bool IsSaved() const;
+    /**
+     * @brief Function to check if the saved state can be restored in the
+     * simulation: the network load, the run index and the number of 
+     * devices of each node must be the same of the saved state.
+     * @return True if the state is saved and can be restored.
+     */
+    bool IsValid() const;
+    /**
+     * @brief Function to get the network load of the saved state.
+     * @return Network load (erlang).
+     */
+    double GetNetworkLoad() const;
+    /**
+     * @brief Function to get the number of calls in progress in the saved
+     * state.
+     * @return Number of calls.
+     */
+    unsigned int GetNumActiveCalls() const;
+private:
+    /**
+     * @brief SimulationType object that owns this snapshot.
+     */
+    SimulationType* simulType;
+    /**
+     * @brief Indicates if the state is saved.
+     */
+    bool saved;
+    /**
+     * @brief Network load of the saved state.
+     */
+    double networkLoad;
+    /**
+     * @brief Simulation time of the saved state.
+     */
+    TIME simulationTime;
+    /**
+     * @brief Copy of the cores of each link, indexed by the node pair.
+     */
+    std::vector<std::vector<Core>> linksState;
+    /**
+     * @brief Copy of the regenerators of each node.
+     */
+    std::vector<std::vector<Regenerator>> regeneratorsState;
+    /**
+     * @brief Copy of the transponders of each node.
+     */
+    std::vector<std::vector<SBVT_TSS_ML>> transpondersState;
+    /**
+     * @brief Calls in progress, with the times of their ends.
+     */
+    std::vector<std::pair<TIME, std::shared_ptr<Call>>> activeCalls;
+    /**
+     * @brief Random engines of the streams.
+     */
+    std::vector<RandomStreams::Engine> engines;
+    /**
+     * @brief Index of the run that saved the state.
+     */
+    unsigned int runIndex;
+};
+
+#endif /* NETWORKSNAPSHOT_H */
+
@@ -30,6 +30,12 @@ public:
      * @param simulIndex Index of this simulation.
      */
     SimulationGA(unsigned int simulIndex, TypeSimulation typeSimulation);
+    /**
+     * @brief Copy constructor for a GA simulation object. The copy does not 
+     * have a GA algorithm, and it is used only to evaluate individuals.
+     * @param orig Original GA simulation object.
+     */
+    SimulationGA(const SimulationGA& orig);
     /**
      * @brief Destructor of a GA simulation object.
      */
@@ -53,7 +59,7 @@ public:
     void LoadFile() override;
     /**
      * @brief Function to apply the additional settings of the GA simulation.
-     * Also initialize the GA algorithm.
+     * Also initialize the GA algorithm, if this simulation is not a copy.
      */
     void AdditionalSettings() override;
     /**
@@ -28,6 +28,11 @@ public:
      * @param simulIndex Index of this simulation.
      */
     SimulationMultiLoad(unsigned int simulIndex, TypeSimulation typeSimulation);
+    /**
+     * @brief Copy constructor for a multi-load simulation object.
+     * @param orig Original multi-load simulation.
+     */
+    SimulationMultiLoad(const SimulationMultiLoad& orig);
     /**
      * @brief Destructor of a multi-load simulation object.
      */
@@ -35,6 +40,9 @@ public:
     
     /**
      * @brief Runs a multiple load simulation with specified parameters.
+     * With the pseudo-random generation, the streams of each load point 
+     * restart from a seed of the point, in the sequential and parallel 
+     * executions.
      */
     virtual void Run() override;
     /**
@@ -64,6 +72,17 @@ public:
      * @param ostream Output stream.
      */
     std::ostream& Help(std::ostream& ostream) override;
+private:
+    /**
+     * @brief Runs the replications of the load points, in parallel if the 
+     * execution option is parallel. Each thread owns a copy of this 
+     * simulation and takes the next replication not yet simulated, in the 
+     * order of the load points. The results of the first replication of 
+     * each point are copied to the data of this simulation, and the metrics
+     * of all replications are added to it. The replications of a point stop
+     * once its confidence interval reaches the precision parameter.
+     */
+    void RunReplications();
 };
 
 #endif /* SIMULATIONMULTILOAD_H */
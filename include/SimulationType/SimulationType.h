@@ -25,6 +25,9 @@ class InputOutput;
 class Traffic;
 class EventGenerator;
 class ResourceAlloc;
+class RandomStreams;
+class NetworkSnapshot;
+class SteadyState;
 
 #include "../Kernel.h"
 #include "../GeneralClasses/Def.h"
@@ -39,6 +42,15 @@ public:
      * @param simulIndex index of this simulation.
      */
     SimulationType(SimulIndex simulIndex, TypeSimulation typeSimulation);
+    /**
+     * @brief Copy constructor for a SimulationType object. The copy shares
+     * the parameters, options, traffic and input/output files of the 
+     * original simulation, and creates its own topology, data, call 
+     * generator, resource allocation and random streams, so both can be 
+     * simulated at the same time.
+     * @param orig Original simulation.
+     */
+    SimulationType(const SimulationType& orig);
     /**
      * @brief Virtual destructor of a SimulationType object.
      */
@@ -62,6 +74,12 @@ public:
      * to the simulation from a .txt file.
      */
     virtual void LoadFile();
+    /**
+     * @brief Load a simulation created by copy. The topology, data,
+     * resource allocation and call generator are created from the inputs
+     * already loaded by the original simulation.
+     */
+    void LoadCopy();
     /**
      * @brief Sets SimulationType additional settings for this simulation,
      * as maximum length and initial cost for the links in topology.
@@ -139,18 +157,56 @@ public:
      * @return pointer to a ResourceAlloc object.
      */
     ResourceAlloc* GetResourceAlloc() const;
+    /**
+     * @brief Returns a pointer to the RandomStreams object
+     * used in this simulation.
+     * @return pointer to a RandomStreams object.
+     */
+    RandomStreams* GetRandomStreams() const;
+    /**
+     * @brief Returns a pointer to the NetworkSnapshot object
+     * of this simulation.
+     * @return pointer to a NetworkSnapshot object.
+     */
+    NetworkSnapshot* GetSnapshot() const;
+    /**
+     * @brief Checks if this simulation is a copy of another simulation.
+     * @return True if it is a copy.
+     */
+    bool IsCopy() const;
+    /**
+     * @brief Returns the index of the run of this simulation.
+     * @return Index of the run.
+     */
+    unsigned int GetRunIndex() const;
+    /**
+     * @brief Sets the index of the run of this simulation. The runs warm up
+     * again when it changes, so the runs with different indexes do not 
+     * share a warm-up.
+     * @param runIndex Index of the run.
+     */
+    void SetRunIndex(unsigned int runIndex);
 private:
     /**
      * @brief Initialize all the simulation parameters, such as
      * Topology and CallGenerator. Also set to 0 the actual number 
-     * of requests.
+     * of requests. If there is a saved network snapshot, the network
+     * starts from it.
      */
     void InitializeAll();
+    /**
+     * @brief Function to simulate the warm-up requests from an empty 
+     * network and save the network snapshot. The statistics of the warm-up
+     * are discarded. The request trace opened by the warm-up is continued by
+     * the run.
+     */
+    void WarmUp();
     /**
      * @brief Function to do the actual simulation, generating the
      * new calls/events and implementing the first event in container.
-     * This function can be limited by the total number of requests
-     * or by the total number of blocked requests.
+     * This function can be limited by the total number of requests,
+     * by the total number of blocked requests or by the convergence of the
+     * blocking probability.
      */
     void Simulate();
     /**
@@ -173,6 +229,19 @@ private:
      * requests.
      */
     void SimulateNumBlocReq();
+    /**
+     * @brief Function to simulate until the confidence interval of the 
+     * blocking probability of the batches reaches the target precision, 
+     * limited by the total number of call requests.
+     */
+    void SimulateBlocConverged();
+    /**
+     * @brief Function to check the end of the transient after an event. 
+     * At the end of the transient the statistics of the actual point and
+     * the number of requests restart.
+     * @return True if the statistics restarted.
+     */
+    bool CheckTransient();
 public:
     /**
      * @brief Actual number of request created.
@@ -189,6 +258,10 @@ private:
      * @brief Index of the simulation
      */
     const SimulIndex simulationIndex;
+    /**
+     * @brief Indicates if this simulation is a copy of another simulation.
+     */
+    const bool isCopy;
     /**
      * @brief pointer to an Parameters object used in this simulation
      */
@@ -208,7 +281,7 @@ private:
     /**
      * @brief pointer to InputOutput object used in this simulation
      */
-    std::unique_ptr<InputOutput> inputOutput;
+    std::shared_ptr<InputOutput> inputOutput;
     /**
      * @brief pointer to Traffic object used in this simulation
      */
@@ -221,6 +294,27 @@ private:
      * @brief Pointer to the ResourceAlloc object of this simulation.
      */
     std::shared_ptr<ResourceAlloc> resourceAlloc;
+    /**
+     * @brief Pointer to the random streams of this simulation.
+     */
+    std::shared_ptr<RandomStreams> randomStreams;
+    /**
+     * @brief Pointer to the network snapshot of this simulation.
+     */
+    std::shared_ptr<NetworkSnapshot> snapshot;
+    /**
+     * @brief Pointer to the steady state detection of this simulation.
+     */
+    std::shared_ptr<SteadyState> steadyState;
+    /**
+     * @brief Simulation time when the statistics of the run started.
+     */
+    TIME statsStartTime;
+    /**
+     * @brief Index of the run, which identifies the warm-up of the network
+     * snapshot.
+     */
+    unsigned int runIndex;
 };
 
 #endif /* SIMULATIONTYPE_H */
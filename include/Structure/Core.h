@@ -20,6 +20,7 @@
 #include <cassert>
 
 #include "Link.h"
+#include "SlotMask.h"
 
 /**
  * @brief Core Class represents a core inside a Fiber. 
@@ -94,13 +95,90 @@ public:
      * @return Core slots state.
      */
     std::vector<SlotState> GetSlotsStatus() const;
+    /**
+     * @brief Function to get the state of a specified slot.
+     * @param sPosition Represents the position of the slot in the core.
+     * @return Slot state.
+     */
+    SlotState GetSlotStatus(SlotIndex sPosition) const;
 
     bool IsSlotOccupied(SlotIndex sPosition, SlotState type);
 
     bool IsSlotFree(SlotIndex sPosition, SlotState state);
+    /**
+     * @brief Check if a set of contiguous slots can be used by a lightpath 
+     * that occupies them with the specified state.
+     * @param firstSlot First slot of the set.
+     * @param lastSlot Last slot of the set.
+     * @param type State the slots would receive.
+     * @return True if all slots of the set are available.
+     */
+    bool IsSlotsFree(SlotIndex firstSlot, SlotIndex lastSlot, 
+    SlotState type) const;
 
     void OccupySlot(SlotIndex sPosition, SlotState state);
-
+    /**
+     * @brief Function to get the mask of free slots of this core.
+     * @return Free slots mask.
+     */
+    const SlotMask& GetFreeSlots() const;
+    /**
+     * @brief Function to get the mask of reserved slots of this core.
+     * @return Reserved slots mask.
+     */
+    const SlotMask& GetReservedSlots() const;
+    /**
+     * @brief Function to get the mask of reutilized slots of this core.
+     * @return Reutilized slots mask.
+     */
+    const SlotMask& GetReutilizedSlots() const;
+    /**
+     * @brief Function to get the mask of the slots that can be occupied with
+     * the specified state. Free slots can be occupied or reserved, while only 
+     * reserved slots can be reutilized.
+     * @param type State the slots would receive.
+     * @return Slots mask.
+     */
+    const SlotMask& GetAvailableSlots(SlotState type) const;
+    /**
+     * @brief Function to get the number of free slots of this core.
+     * @return Number of free slots.
+     */
+    unsigned int GetNumFreeSlots() const;
+    /**
+     * @brief Function to get the size of the largest block of contiguous 
+     * free slots of this core.
+     * @return Size of the largest free block.
+     */
+    unsigned int GetLargestFreeBlock() const;
+    /**
+     * @brief Function to get the number of calls, summed over the traffic 
+     * classes of the topology, that could be allocated simultaneously in 
+     * the free blocks of this core.
+     * @return Number of simultaneous allocations.
+     */
+    unsigned int GetNumSimultAloc() const;
+private:
+    /**
+     * @brief Set a slot as free, merging the free blocks around it.
+     * @param sPosition Slot index.
+     */
+    void SetSlotFree(SlotIndex sPosition);
+    /**
+     * @brief Set a free slot as not free, splitting its free block.
+     * @param sPosition Slot index.
+     */
+    void ResetSlotFree(SlotIndex sPosition);
+    /**
+     * @brief Add a block of contiguous free slots to the block counters.
+     * @param blockSize Size of the block.
+     */
+    void AddFreeBlock(unsigned int blockSize);
+    /**
+     * @brief Remove a block of contiguous free slots from the block counters.
+     * @param blockSize Size of the block.
+     */
+    void RemoveFreeBlock(unsigned int blockSize);
 private:
     /**
      * @brief Link in which this core is inserted.
@@ -111,9 +189,35 @@ private:
      */
     CoreIndex coreId;
     /**
-     * @brief Vector of slots of this core.
+     * @brief Mask of the free slots of this core.
+     */
+    SlotMask freeSlots;
+    /**
+     * @brief Mask of the reserved slots of this core.
+     */
+    SlotMask reservedSlots;
+    /**
+     * @brief Mask of the reutilized slots of this core. The occupied slots 
+     * are the ones that are not set in any of the masks.
+     */
+    SlotMask reutilizedSlots;
+    /**
+     * @brief Number of maximal blocks of contiguous free slots, for each 
+     * block size.
+     */
+    std::vector<unsigned int> numFreeBlocks;
+    /**
+     * @brief Number of free slots of this core.
+     */
+    unsigned int numFreeSlots;
+    /**
+     * @brief Size of the largest block of contiguous free slots.
+     */
+    unsigned int largestFreeBlock;
+    /**
+     * @brief Number of simultaneous allocations in the free blocks.
      */
-    std::vector<SlotState> slotsStatus;
+    unsigned int numSimultAloc;
     /**
      * @brief Core state (working or notWorking).
      */
@@ -41,7 +41,8 @@ public:
      */
     void Initialize() override;
     /**
-     * @brief Function to return the number of fre subcarriers.
+     * @brief Function to return the number of fre subcarriers. The number is
+     * kept by the connections and releases, so it takes constant time.
      * @return Number of fre subcarriers.
      */
     unsigned int GetNumberFreeSubCarriers() const override;
@@ -77,6 +78,10 @@ private:
      * @brief Container of call requests that occupies the subcarriers.
      */
     std::vector<CallDevices*> calls;
+    /**
+     * @brief Number of free subcarriers in this SBVT.
+     */
+    unsigned int numFreeSubCarriers;
     /**
      * @brief Total number of subcarriers in this SBVT.
      */
@@ -23,6 +23,7 @@
 class Topology;
 class Signal;
 class Core;
+class SlotMask;
 
 #include "../GeneralClasses/Def.h"
 
@@ -125,7 +126,8 @@ public:
     
     /**
      * @brief Update the signal power, ASE power and
-     * nonlinear power crossing this link.
+     * nonlinear power crossing this link. The section gains and ASE power are
+     * calculated once, in the link creation.
      * @param signal Signal pointer that will be updated.
      */
     void CalcSignal(Signal* signal) const;
@@ -193,6 +195,18 @@ public:
      * @return Number of free slots.
      */
     unsigned int GetNumberFreeSlots(const CoreIndex coreId) const;
+    /**
+     * @brief Return the size of the largest block of contiguous free slots 
+     * in the link (single core).
+     * @return Size of the largest free block.
+     */
+    unsigned int GetLargestFreeBlock() const;
+    /**
+     * @brief Return the number of calls, summed over the traffic classes, 
+     * that could be allocated simultaneously in the link (single core).
+     * @return Number of simultaneous allocations.
+     */
+    unsigned int GetNumSimultAloc() const;
     /**
      * @brief Return the number of occupied slots in the link.
      * @return Number of occupied slots.
@@ -216,6 +230,44 @@ public:
      * @return Availability vector.
      */
     std::vector<SlotState> GetVecDisp(const CoreIndex coreId) const;
+    /**
+     * @brief Function to get the mask of free slots of a specified core.
+     * @param coreId Core index.
+     * @return Free slots mask.
+     */
+    const SlotMask& GetFreeSlots(const CoreIndex coreId) const;
+    /**
+     * @brief Function to get the mask of the slots of a specified core that
+     * can be occupied with the specified state.
+     * @param coreId Core index.
+     * @param type State the slots would receive.
+     * @return Slots mask.
+     */
+    const SlotMask& GetAvailableSlots(const CoreIndex coreId, 
+    SlotState type) const;
+    /**
+     * @brief Check if a set of contiguous slots of a specified core can be 
+     * occupied with the specified state.
+     * @param coreId Core index.
+     * @param firstSlot First slot of the set.
+     * @param lastSlot Last slot of the set.
+     * @param type State the slots would receive.
+     * @return True if all slots of the set are available.
+     */
+    bool IsSlotsFree(const CoreIndex coreId, const SlotIndex firstSlot, 
+    const SlotIndex lastSlot, SlotState type) const;
+    /**
+     * @brief Function to get a copy of the cores of the link, with the 
+     * state of their slots.
+     * @return Copy of the cores.
+     */
+    std::vector<Core> GetCoresState() const;
+    /**
+     * @brief Function to set the state of the cores of the link from a copy
+     * taken from this same link.
+     * @param coresState Copy of the cores.
+     */
+    void SetCoresState(const std::vector<Core>& coresState);
     /**
      * @brief Function to return pointer of the topology
      * @return Pointer to topology
@@ -248,6 +300,19 @@ private:
      * @brief Number of sections of this link
      */
     const unsigned int numberSections;
+    /**
+     * @brief Signal gain of each fiber section (linear), inverse of the
+     * section loss.
+     */
+    const double sectionLoss;
+    /**
+     * @brief Gain of the amplifier at the end of each section (linear).
+     */
+    const double sectionGain;
+    /**
+     * @brief ASE power added by the amplifier of each section.
+     */
+    const double sectionAsePower;
     /**
      * @brief Cost of this link, based in the 
      * selected metric
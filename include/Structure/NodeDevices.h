@@ -19,11 +19,14 @@
 
 class Regenerator;
 class BVT;
+class SBVT_TSS_ML;
 class Call;
 class CallDevices;
 
 #include "Node.h"
 #include "Devices/Regenerator.h"
+#include "Devices/SBVT_TSS_ML.h"
+#include "../GeneralClasses/IndexPool.h"
 
 /**
  * Class that represents a optical node which contain devices. 
@@ -69,13 +72,17 @@ public:
      */
     unsigned int GetNumOccRegenerators() const;
     /**
-     * @brief Function to increase the number of free regenerators.
+     * @brief Function to remove a regenerator of this node from the pool of
+     * free regenerators, when it is set on.
+     * @param regenerator Regenerator of this node.
      */
-    void IncreaseNumFreeRegenerators();
+    void OccupyRegenerator(const Regenerator* regenerator);
     /**
-     * @brief Function to decrease the number of free regenerators.
+     * @brief Function to return a regenerator of this node to the pool of
+     * free regenerators, when it is set off.
+     * @param regenerator Regenerator of this node.
      */
-    void DecreaseNumFreeRegenerators();
+    void ReleaseRegenerator(const Regenerator* regenerator);
     /**
      * @brief Function to check if there is free regenerators in this node for a 
      * specified bit rate value.
@@ -85,12 +92,12 @@ public:
     bool isThereFreeRegenerators(double bitRate) const;
     /**
      * @brief Function to get the container of free regenerators for a specified
-     * bit rate value.
+     * bit rate value. The regenerators are taken from the pool of free 
+     * regenerators, in time proportional to their number.
      * @param bitRate Traffic bit rate value.
      * @return Container of free regenerators.
      */
-    std::vector<std::shared_ptr<Regenerator>> GetFreeRegenenerators(
-                                              double bitRate) const;
+    std::vector<Regenerator*> GetFreeRegenenerators(double bitRate);
     /**
      * @brief Function to get the number of vitualized regenerators required 
      * for call request regeneration.
@@ -111,6 +118,16 @@ public:
      * @param numTransponder Total number of transponders.
      */
     void SetNumTransponder(unsigned int numTransponder);
+    /**
+     * @brief Function to update the free subcarriers of this node after a
+     * transponder of this node occupies or releases subcarriers.
+     * @param transponder Transponder of this node.
+     * @param numSubCarriers Number of subcarriers occupied (if occupy is 
+     * true) or released (if false).
+     * @param occupy True if the subcarriers were occupied.
+     */
+    void UpdateFreeSubCarriers(const BVT* transponder, 
+                               unsigned int numSubCarriers, bool occupy);
     /**
      * @brief Function to check if there is free BVT for a specified slots
      * amount.
@@ -120,12 +137,42 @@ public:
     bool isThereFreeBVT(unsigned int numSlots) const;
     /**
      * @brief Function to get free BVTs used to allocate a specified call 
-     * request.
+     * request. The BVTs are taken from the pool of BVTs with free 
+     * subcarriers, in time proportional to their number.
      * @param call Call request with devices to allocate.
      * @return Container of BVTs that will be used to allocate the call 
      * request.
      */
-    std::vector<std::shared_ptr<BVT>> GetBVTs(CallDevices* call) const;
+    std::vector<BVT*> GetBVTs(CallDevices* call);
+    
+    /**
+     * @brief Function to get a copy of the regenerators of this node, with
+     * their state.
+     * @return Copy of the regenerators.
+     */
+    std::vector<Regenerator> GetRegeneratorsState() const;
+    /**
+     * @brief Function to set the state of the regenerators of this node from
+     * a copy taken from this same node. The pool of free regenerators is
+     * rebuilt.
+     * @param regeneratorsState Copy of the regenerators.
+     */
+    void SetRegeneratorsState(const std::vector<Regenerator>& 
+                              regeneratorsState);
+    /**
+     * @brief Function to get a copy of the transponders of this node, with
+     * the state of their subcarriers.
+     * @return Copy of the transponders.
+     */
+    std::vector<SBVT_TSS_ML> GetTranspondersState() const;
+    /**
+     * @brief Function to set the state of the transponders of this node from
+     * a copy taken from this same node. The pool of BVTs with free 
+     * subcarriers and the number of free subcarriers are rebuilt.
+     * @param transpondersState Copy of the transponders.
+     */
+    void SetTranspondersState(const std::vector<SBVT_TSS_ML>& 
+                              transpondersState);
 private:
     /**
      * @brief Function to initialize the virtualized regenerators in this node. 
@@ -161,13 +208,13 @@ private:
      */
     unsigned int numRegenerator;
     /**
-     * @brief Number of free regenerators in this node.
+     * @brief Container of regenerators in this node.
      */
-    unsigned int numFreeRegenerators;
+    std::vector<Regenerator> regenerators;
     /**
-     * @brief Container of regenerators in this node.
+     * @brief Pool of the indexes of the free regenerators in this node.
      */
-    std::vector<std::shared_ptr<Regenerator>> regenerators;
+    IndexPool freeRegenerators;
     
     /**
      * @brief Total number of transponders in this node.
@@ -176,7 +223,17 @@ private:
     /**
      * @brief Container of transponders in this node.
      */
-    std::vector<std::shared_ptr<BVT>> transponders;
+    std::vector<SBVT_TSS_ML> transponders;
+    /**
+     * @brief Pool of the indexes of the transponders with free subcarriers in
+     * this node.
+     */
+    IndexPool freeTransponders;
+    /**
+     * @brief Total number of free subcarriers of the transponders in this 
+     * node.
+     */
+    unsigned int numFreeSubCarriers;
 };
 
 #endif /* NODEDEVICES_H */
@@ -0,0 +1,171 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   SlotMask.h
+ * Author: agent
+ *
+ * Created on October 17, 2026, 2:56 PM
+ */
+
+#ifndef SLOTMASK_H
+#define SLOTMASK_H
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+
+#include "../GeneralClasses/Def.h"
+
+/**
+ * @brief Class SlotMask represents a packed set of slots, with one bit per
+ * slot. It is used to store the spectrum occupancy of cores and to evaluate
+ * the availability of routes, 64 slots at a time. The functions that take a
+ * slot index throw std::out_of_range for slots outside the mask, as the
+ * vector::at() accesses they replace.
+ */
+class SlotMask {
+public:
+    /**
+     * @brief Type of the words that store the slots bits.
+     */
+    typedef std::uint64_t Word;
+    /**
+     * @brief Number of slots stored in each word.
+     */
+    static const unsigned int wordSize;
+
+    /**
+     * @brief Default constructor of a SlotMask object, without slots.
+     */
+    SlotMask();
+    /**
+     * @brief Standard constructor of a SlotMask object.
+     * @param numSlots Number of slots of the mask.
+     * @param value Initial value of all slots of the mask.
+     */
+    SlotMask(unsigned int numSlots, bool value);
+    /**
+     * @brief Virtual destructor of a SlotMask object.
+     */
+    virtual ~SlotMask();
+
+    /**
+     * @brief Function to set all slots of the mask to the specified value.
+     * @param value Value of the slots.
+     */
+    void Assign(bool value);
+    /**
+     * @brief Set a specified slot of the mask.
+     * @param pos Slot index.
+     */
+    void Set(SlotIndex pos);
+    /**
+     * @brief Reset a specified slot of the mask.
+     * @param pos Slot index.
+     */
+    void Reset(SlotIndex pos);
+    /**
+     * @brief Check if a specified slot is set in the mask.
+     * @param pos Slot index.
+     * @return True if the slot is set.
+     */
+    bool Test(SlotIndex pos) const;
+    /**
+     * @brief Check if all slots of a specified range are set in the mask.
+     * @param firstSlot First slot of the range.
+     * @param lastSlot Last slot of the range.
+     * @return True if all slots of the range are set.
+     */
+    bool Test(SlotIndex firstSlot, SlotIndex lastSlot) const;
+    /**
+     * @brief Intersects this mask with another mask, with the same number of
+     * slots.
+     * @param mask Mask to intersect.
+     * @return Reference to this mask.
+     */
+    SlotMask& operator&=(const SlotMask& mask);
+    /**
+     * @brief Function to get the number of slots set in the mask.
+     * @return Number of slots set.
+     */
+    unsigned int Count() const;
+    /**
+     * @brief Function to get the first slot set in the mask, starting from a
+     * specified slot.
+     * @param pos Initial slot of the search.
+     * @return Index of the first set slot. Def::Max_UnInt if there is none.
+     */
+    SlotIndex FindNext(SlotIndex pos) const;
+    /**
+     * @brief Function to get the number of contiguous set slots immediately
+     * before a specified slot.
+     * @param pos Slot index.
+     * @return Number of set slots.
+     */
+    unsigned int CountSetBefore(SlotIndex pos) const;
+    /**
+     * @brief Function to get the number of contiguous set slots immediately
+     * after a specified slot.
+     * @param pos Slot index.
+     * @return Number of set slots.
+     */
+    unsigned int CountSetAfter(SlotIndex pos) const;
+    /**
+     * @brief Function to get a mask with the slots that start a block of
+     * contiguous set slots of a specified size in this mask.
+     * @param blockSize Size of the block.
+     * @return Mask with the first slots of the blocks.
+     */
+    SlotMask GetBlocksStart(unsigned int blockSize) const;
+    /**
+     * @brief Function to get the first slot of the first block of contiguous
+     * set slots of a specified size.
+     * @param blockSize Size of the block.
+     * @return First slot of the block. Def::Max_UnInt if there is none.
+     */
+    SlotIndex FindFirstBlock(unsigned int blockSize) const;
+    /**
+     * @brief Function to get the number of slots of the mask.
+     * @return Number of slots.
+     */
+    unsigned int GetNumSlots() const;
+    /**
+     * @brief Function to get the words that store the mask.
+     * @return Container of words.
+     */
+    const std::vector<Word>& GetWords() const;
+private:
+    /**
+     * @brief Check if a slot index is inside the mask.
+     * @param pos Slot index.
+     * @param function Name of the calling function, used in the exception.
+     */
+    void CheckSlot(SlotIndex pos, const char* function) const;
+    /**
+     * @brief Shift all slots of the mask to lower indexes, i.e., the slot
+     * pos receives the value of the slot pos+shift.
+     * @param shift Number of positions.
+     */
+    void ShiftDown(unsigned int shift);
+    /**
+     * @brief Clear the bits of the last word that do not correspond to slots.
+     */
+    void ClearUnusedBits();
+private:
+    /**
+     * @brief Number of slots of the mask.
+     */
+    unsigned int numSlots;
+    /**
+     * @brief Words that store the slots bits. The slot s is stored in the
+     * bit s%64 of the word s/64.
+     */
+    std::vector<Word> words;
+};
+
+#endif /* SLOTMASK_H */
+
@@ -20,6 +20,7 @@
 #include "NodeDevices.h"
 #include "Link.h"
 #include "Core.h"
+#include "SlotMask.h"
 
 //Devices structures
 #include "Devices/Device.h"
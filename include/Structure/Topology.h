@@ -109,6 +109,20 @@ public:
      * @param numSlots total number of slots
      */
     void SetNumSlots(unsigned int numSlots);
+    /**
+     * @brief Sets the number of slots of each traffic class, used to 
+     * evaluate the number of simultaneous allocations in the free blocks of
+     * the links.
+     * @param numSlotsTraffic Number of slots of each traffic class.
+     */
+    void SetNumSlotsTraffic(const std::vector<unsigned int>& numSlotsTraffic);
+    /**
+     * @brief Returns the number of calls, summed over the traffic classes, 
+     * that can be allocated simultaneously in a block of contiguous slots.
+     * @param blockSize Number of slots of the block.
+     * @return Number of simultaneous allocations.
+     */
+    unsigned int GetNumSimultAloc(unsigned int blockSize) const;
     /**
      * @brief Insert a created link in the topology
      * The ownership belongs to the vector
@@ -357,6 +371,11 @@ private:
      * @brief Number of transponders in the network.
      */
     unsigned int numTransponders;
+    /**
+     * @brief Number of simultaneous allocations in a block, for each block
+     * size. Empty while the traffic classes are not set.
+     */
+    std::vector<unsigned int> numSimultAloc;
 
     void ConnectWithoutDevices(Call *call, SlotState state);
 };
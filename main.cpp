@@ -29,8 +29,8 @@ int main(int argc, char** argv) {
     std::cout << "\t----OPTICAL NETWORKS SIMULATOR----"  << std::endl;
 
     std::shared_ptr<Kernel> kernel = std::make_shared<Kernel>();
-    kernel->Run();
+    int exitCode = kernel->Run(argc, argv);
     kernel.reset();
 
-    return 0;
+    return exitCode;
 }
\ No newline at end of file
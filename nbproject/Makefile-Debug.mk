@@ -56,19 +56,28 @@ OBJECTFILES= \
 	${OBJECTDIR}/src/Calls/CallDevices.o \
 	${OBJECTDIR}/src/Calls/Event.o \
 	${OBJECTDIR}/src/Calls/EventGenerator.o \
+	${OBJECTDIR}/src/Calls/EventQueue.o \
+	${OBJECTDIR}/src/Calls/EventTrace.o \
 	${OBJECTDIR}/src/Calls/Traffic.o \
 	${OBJECTDIR}/src/Data/Data.o \
 	${OBJECTDIR}/src/Data/InputOutput.o \
 	${OBJECTDIR}/src/Data/Options.o \
 	${OBJECTDIR}/src/Data/Parameters.o \
+	${OBJECTDIR}/src/Data/ResultWriter.o \
+	${OBJECTDIR}/src/Data/SteadyState.o \
+	${OBJECTDIR}/src/GeneralClasses/AliasTable.o \
 	${OBJECTDIR}/src/GeneralClasses/Def.o \
 	${OBJECTDIR}/src/GeneralClasses/General.o \
+	${OBJECTDIR}/src/GeneralClasses/IndexPool.o \
+	${OBJECTDIR}/src/GeneralClasses/Profiler.o \
+	${OBJECTDIR}/src/GeneralClasses/RandomStreams.o \
 	${OBJECTDIR}/src/Kernel.o \
 	${OBJECTDIR}/src/ResourceAllocation/CSA.o \
 	${OBJECTDIR}/src/ResourceAllocation/Modulation.o \
 	${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/DedicatedPathProtection.o \
 	${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/NewPathProtection.o \
 	${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/PartitioningDedicatedPathProtection.o \
+	${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.o \
 	${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/ProtectionScheme.o \
 	${OBJECTDIR}/src/ResourceAllocation/RegeneratorAssignment/DRE2BR.o \
 	${OBJECTDIR}/src/ResourceAllocation/RegeneratorAssignment/FirstLongestReach.o \
@@ -83,10 +92,12 @@ OBJECTFILES= \
 	${OBJECTDIR}/src/ResourceAllocation/ResourceAlloc.o \
 	${OBJECTDIR}/src/ResourceAllocation/ResourceDeviceAlloc.o \
 	${OBJECTDIR}/src/ResourceAllocation/Resources.o \
+	${OBJECTDIR}/src/ResourceAllocation/ResourcesCache.o \
 	${OBJECTDIR}/src/ResourceAllocation/Route.o \
 	${OBJECTDIR}/src/ResourceAllocation/Routing.o \
 	${OBJECTDIR}/src/ResourceAllocation/SA.o \
 	${OBJECTDIR}/src/ResourceAllocation/Signal.o \
+	${OBJECTDIR}/src/SimulationType/NetworkSnapshot.o \
 	${OBJECTDIR}/src/SimulationType/SimulationGA.o \
 	${OBJECTDIR}/src/SimulationType/SimulationMultiLoad.o \
 	${OBJECTDIR}/src/SimulationType/SimulationMultiNumDevices.o \
@@ -100,6 +111,7 @@ OBJECTFILES= \
 	${OBJECTDIR}/src/Structure/Link.o \
 	${OBJECTDIR}/src/Structure/Node.o \
 	${OBJECTDIR}/src/Structure/NodeDevices.o \
+	${OBJECTDIR}/src/Structure/SlotMask.o \
 	${OBJECTDIR}/src/Structure/Topology.o
 
 
@@ -108,7 +120,7 @@ CFLAGS=
 
 # CC Compiler Flags
 CCFLAGS=
-CXXFLAGS=
+CXXFLAGS=-DONS_PROFILER
 
 # Fortran Compiler Flags
 FFLAGS=
@@ -117,7 +129,7 @@ FFLAGS=
 ASFLAGS=
 
 # Link Libraries and Options
-LDLIBSOPTIONS=
+LDLIBSOPTIONS=-lpthread
 
 # Build Targets
 .build-conf: ${BUILD_SUBPROJECTS}
@@ -232,6 +244,16 @@ ${OBJECTDIR}/src/Calls/EventGenerator.o: src/Calls/EventGenerator.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Calls/EventGenerator.o src/Calls/EventGenerator.cpp
 
+${OBJECTDIR}/src/Calls/EventQueue.o: src/Calls/EventQueue.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/Calls
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Calls/EventQueue.o src/Calls/EventQueue.cpp
+
+${OBJECTDIR}/src/Calls/EventTrace.o: src/Calls/EventTrace.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/Calls
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Calls/EventTrace.o src/Calls/EventTrace.cpp
+
 ${OBJECTDIR}/src/Calls/Traffic.o: src/Calls/Traffic.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/Calls
 	${RM} "$@.d"
@@ -257,6 +279,21 @@ ${OBJECTDIR}/src/Data/Parameters.o: src/Data/Parameters.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Data/Parameters.o src/Data/Parameters.cpp
 
+${OBJECTDIR}/src/Data/ResultWriter.o: src/Data/ResultWriter.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/Data
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Data/ResultWriter.o src/Data/ResultWriter.cpp
+
+${OBJECTDIR}/src/Data/SteadyState.o: src/Data/SteadyState.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/Data
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Data/SteadyState.o src/Data/SteadyState.cpp
+
+${OBJECTDIR}/src/GeneralClasses/AliasTable.o: src/GeneralClasses/AliasTable.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/GeneralClasses
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/GeneralClasses/AliasTable.o src/GeneralClasses/AliasTable.cpp
+
 ${OBJECTDIR}/src/GeneralClasses/Def.o: src/GeneralClasses/Def.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/GeneralClasses
 	${RM} "$@.d"
@@ -267,6 +304,21 @@ ${OBJECTDIR}/src/GeneralClasses/General.o: src/GeneralClasses/General.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/GeneralClasses/General.o src/GeneralClasses/General.cpp
 
+${OBJECTDIR}/src/GeneralClasses/IndexPool.o: src/GeneralClasses/IndexPool.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/GeneralClasses
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/GeneralClasses/IndexPool.o src/GeneralClasses/IndexPool.cpp
+
+${OBJECTDIR}/src/GeneralClasses/Profiler.o: src/GeneralClasses/Profiler.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/GeneralClasses
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/GeneralClasses/Profiler.o src/GeneralClasses/Profiler.cpp
+
+${OBJECTDIR}/src/GeneralClasses/RandomStreams.o: src/GeneralClasses/RandomStreams.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/GeneralClasses
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/GeneralClasses/RandomStreams.o src/GeneralClasses/RandomStreams.cpp
+
 ${OBJECTDIR}/src/Kernel.o: src/Kernel.cpp
 	${MKDIR} -p ${OBJECTDIR}/src
 	${RM} "$@.d"
@@ -297,6 +349,11 @@ ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/PartitioningDedicatedPathP
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/PartitioningDedicatedPathProtection.o src/ResourceAllocation/ProtectionSchemes/PartitioningDedicatedPathProtection.cpp
 
+${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.o: src/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.o src/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.cpp
+
 ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes/ProtectionScheme.o: src/ResourceAllocation/ProtectionSchemes/ProtectionScheme.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/ResourceAllocation/ProtectionSchemes
 	${RM} "$@.d"
@@ -367,6 +424,11 @@ ${OBJECTDIR}/src/ResourceAllocation/Resources.o: src/ResourceAllocation/Resource
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/ResourceAllocation/Resources.o src/ResourceAllocation/Resources.cpp
 
+${OBJECTDIR}/src/ResourceAllocation/ResourcesCache.o: src/ResourceAllocation/ResourcesCache.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/ResourceAllocation
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/ResourceAllocation/ResourcesCache.o src/ResourceAllocation/ResourcesCache.cpp
+
 ${OBJECTDIR}/src/ResourceAllocation/Route.o: src/ResourceAllocation/Route.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/ResourceAllocation
 	${RM} "$@.d"
@@ -387,6 +449,11 @@ ${OBJECTDIR}/src/ResourceAllocation/Signal.o: src/ResourceAllocation/Signal.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/ResourceAllocation/Signal.o src/ResourceAllocation/Signal.cpp
 
+${OBJECTDIR}/src/SimulationType/NetworkSnapshot.o: src/SimulationType/NetworkSnapshot.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/SimulationType
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/SimulationType/NetworkSnapshot.o src/SimulationType/NetworkSnapshot.cpp
+
 ${OBJECTDIR}/src/SimulationType/SimulationGA.o: src/SimulationType/SimulationGA.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/SimulationType
 	${RM} "$@.d"
@@ -452,6 +519,11 @@ ${OBJECTDIR}/src/Structure/NodeDevices.o: src/Structure/NodeDevices.cpp
 	${RM} "$@.d"
 	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Structure/NodeDevices.o src/Structure/NodeDevices.cpp
 
+${OBJECTDIR}/src/Structure/SlotMask.o: src/Structure/SlotMask.cpp
+	${MKDIR} -p ${OBJECTDIR}/src/Structure
+	${RM} "$@.d"
+	$(COMPILE.cc) -g -Wall -std=c++11 -MMD -MP -MF "$@.d" -o ${OBJECTDIR}/src/Structure/SlotMask.o src/Structure/SlotMask.cpp
+
 ${OBJECTDIR}/src/Structure/Topology.o: src/Structure/Topology.cpp
 	${MKDIR} -p ${OBJECTDIR}/src/Structure
 	${RM} "$@.d"
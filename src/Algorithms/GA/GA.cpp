@@ -11,11 +11,18 @@
  * Created on February 27, 2019, 10:07 PM
  */
 
+#include <thread>
+#include <mutex>
+#include <boost/make_unique.hpp>
+
 #include "../../../include/Algorithms/GA/GA.h"
 #include "../../../include/GeneralClasses/Def.h"
 #include "../../../include/SimulationType/SimulationType.h"
-
-std::default_random_engine GA::random_generator(Def::randomDevice());
+#include "../../../include/SimulationType/SimulationGA.h"
+#include "../../../include/Data/Options.h"
+#include "../../../include/Data/Data.h"
+#include "../../../include/Calls/EventGenerator.h"
+#include "../../../include/GeneralClasses/RandomStreams.h"
 
 std::ostream& operator<<(std::ostream& ostream, const GA* ga) {
     ostream << "Generation: " << ga->actualGeneration << std::endl;
@@ -27,7 +34,8 @@ std::ostream& operator<<(std::ostream& ostream, const GA* ga) {
 GA::GA(SimulationType* simul)
 :simul(simul), numberIndividuals(20), numberGenerations(10),
 probCrossover(0.5), probMutation(0.1), actualGeneration(0), 
-maxNumSimulation(3), loadPoint(0.0) {
+maxNumSimulation(3), loadPoint(0.0), simulCopies(0), numDispatchedInd(0),
+random_generator(simul->GetRandomStreams()->GetEngine(StreamGA)) {
     
 }
 
@@ -144,3 +152,88 @@ std::ostream& GA::printParameters(std::ostream& ostream) const {
     
     return ostream;
 }
+
+void GA::RunPopulation(const std::vector<std::shared_ptr<Individual>>& 
+population, const std::function<bool(Individual*, unsigned int)>& checkRun) {
+    
+    if(this->simul->GetOptions()->GetExecutionOption() != ExecutionParallel){
+        
+        for(auto it: population){
+            
+            for(unsigned int a = 0; checkRun(it.get(), a); a++){
+                this->ApplyIndividual(it.get(), this->simul);
+                this->simul->RunBase();
+                this->SetIndParameters(it.get(), this->simul);
+                this->simul->GetData()->Initialize();
+            }
+        }
+        return;
+    }
+    
+    if(this->simulCopies.empty())
+        this->CreateSimulCopies();
+    
+    bool seedPerInd = (this->simul->GetOptions()->GetGenerationOption() == 
+                       GenerationPseudoRandom);
+    unsigned int firstDispatchedInd = this->numDispatchedInd;
+    unsigned int nextInd = 0;
+    std::vector<std::thread> threads;
+    std::mutex indMutex;
+    
+    for(auto& it: this->simulCopies){
+        SimulationType* simulCopy = it.get();
+        
+        threads.push_back(std::thread([&, simulCopy](){
+            unsigned int index;
+            Individual* ind;
+            
+            while(true){
+                {
+                    std::lock_guard<std::mutex> lock(indMutex);
+                    
+                    if(nextInd == population.size())
+                        break;
+                    index = nextInd++;
+                }
+                ind = population.at(index).get();
+                //Each individual warms up on its own, so its fitness does not
+                //depend on the individuals simulated before in the thread.
+                simulCopy->SetRunIndex(firstDispatchedInd + index);
+                
+                //Each individual has its own sequence, independent of the
+                //thread that simulates it.
+                if(seedPerInd)
+                    simulCopy->GetRandomStreams()->RestartSimulStreams(
+                    firstDispatchedInd + index);
+                
+                for(unsigned int a = 0; checkRun(ind, a); a++){
+                    this->ApplyIndividual(ind, simulCopy);
+                    simulCopy->RunBase();
+                    this->SetIndParameters(ind, simulCopy);
+                    simulCopy->GetData()->Initialize();
+                }
+            }
+        }));
+    }
+    
+    for(auto& it: threads)
+        it.join();
+    this->numDispatchedInd += population.size();
+}
+
+void GA::CreateSimulCopies() {
+    SimulationGA* simulGA = dynamic_cast<SimulationGA*>(this->simul);
+    unsigned int numThreads = std::min(this->numberIndividuals, 
+    std::max(1U, std::thread::hardware_concurrency()));
+    assert(simulGA != nullptr);
+    
+    //The copies are loaded one at a time, since some offline settings
+    //change the parameters shared with this simulation.
+    for(unsigned int a = 0; a < numThreads; a++){
+        this->simulCopies.push_back(boost::make_unique<SimulationGA>(
+                                    *simulGA));
+        this->simulCopies.back()->LoadCopy();
+        this->simulCopies.back()->GetCallGenerator()->SetNetworkLoad(
+        this->loadPoint);
+    }
+}
@@ -125,39 +125,28 @@ void GA_MO::SaveIndividuals() {
 
 void GA_MO::RunSelectPop() {
     
-    for(auto it: this->actualParetoFronts.front()){
-        this->ApplyIndividual(it.get());
-        this->GetSimul()->RunBase();
-        this->SetIndParameters(it.get());
-        this->GetSimul()->GetData()->Initialize();
-    }
+    this->RunPopulation(this->actualParetoFronts.front(), 
+    [](Individual*, unsigned int numRuns){
+        return numRuns == 0;
+    });
 }
 
 void GA_MO::RunTotalPop() {
     unsigned int maxNumSimulPerInd = this->GetMaxNumSimulation();
     
-    for(auto it: this->totalPopulation){
-        
-        if(it->GetCount() < maxNumSimulPerInd){
-            this->ApplyIndividual(it.get());
-            this->GetSimul()->RunBase();
-            this->SetIndParameters(it.get());
-        }
-        this->GetSimul()->GetData()->Initialize();
-    }
+    this->RunPopulation(this->totalPopulation, 
+    [maxNumSimulPerInd](Individual* ind, unsigned int numRuns){
+        return numRuns == 0 && ind->GetCount() < maxNumSimulPerInd;
+    });
 }
 
 void GA_MO::CheckMinSimul() {
     unsigned int maxNumSimulPerInd = this->GetMaxNumSimulation();
-
-    for(auto it: this->totalPopulation){
-        while(it->GetCount() < maxNumSimulPerInd){
-            this->ApplyIndividual(it.get());
-            this->GetSimul()->RunBase();
-            this->SetIndParameters(it.get());
-            this->GetSimul()->GetData()->Initialize();
-        }
-    }
+    
+    this->RunPopulation(this->totalPopulation, 
+    [maxNumSimulPerInd](Individual* ind, unsigned int){
+        return ind->GetCount() < maxNumSimulPerInd;
+    });
 }
 
 unsigned int GA_MO::GetNumIndParetoFronts() const {
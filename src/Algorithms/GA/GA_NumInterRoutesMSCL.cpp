@@ -54,16 +54,18 @@ void GA_NumInterRoutesMSCL::CreateNewPopulation() {
     this->UpdateNumInterRoutes();
 }
 
-void GA_NumInterRoutesMSCL::ApplyIndividual(Individual* ind) {
+void GA_NumInterRoutesMSCL::ApplyIndividual(Individual* ind, 
+SimulationType* simul) {
     IndividualNumRoutesMSCL* auxInd = dynamic_cast<IndividualNumRoutesMSCL*>
                                       (ind);
-    this->GetSimul()->GetResourceAlloc()
+    simul->GetResourceAlloc()
         ->SetNumInterRoutesToCheck(auxInd->GetGenes());
 }
 
-void GA_NumInterRoutesMSCL::SetIndParameters(Individual* ind) {
-    double blockProb = this->GetSimul()->GetData()->GetReqBP();
-    TIME simulTime = this->GetSimul()->GetData()->GetRealSimulTime();
+void GA_NumInterRoutesMSCL::SetIndParameters(Individual* ind, 
+SimulationType* simul) {
+    double blockProb = simul->GetData()->GetReqBP();
+    TIME simulTime = simul->GetData()->GetRealSimulTime();
     
     IndividualNumRoutesMSCL* auxInd = dynamic_cast<IndividualNumRoutesMSCL*>
                                       (ind);
@@ -171,15 +171,24 @@ void GA_PDPPBO::CreateIndexDistributions(void) {
     }
 }
 
-void GA_PDPPBO::ApplyIndividual(Individual* ind) {
+void GA_PDPPBO::ApplyIndividual(Individual* ind, SimulationType* simul) {
     IndividualPDPPBO* auxInd = dynamic_cast<IndividualPDPPBO*>(ind);
-    this->pdppbo->SetPDPPBitRateNodePairsDist(auxInd->GetGenes());
+    PartitioningDedicatedPathProtection* auxPdppbo = this->pdppbo;
+    
+    //The copies of the simulation have their own protection scheme.
+    if(simul != this->GetSimul()){
+        ResourceDeviceAlloc* resource_alloc = dynamic_cast<ResourceDeviceAlloc*>
+                                              (simul->GetResourceAlloc());
+        auxPdppbo = dynamic_cast<PartitioningDedicatedPathProtection*>
+                    (resource_alloc->GetProtectionScheme());
+    }
+    auxPdppbo->SetPDPPBitRateNodePairsDist(auxInd->GetGenes());
 
 }
 
-void GA_PDPPBO::SetIndParameters(Individual* ind) {
-    double blockProb = this->GetSimul()->GetData()->GetReqBP();
-    double betaAverage = this->GetSimul()->GetData()->GetNetBetaAverage();
+void GA_PDPPBO::SetIndParameters(Individual* ind, SimulationType* simul) {
+    double blockProb = simul->GetData()->GetReqBP();
+    double betaAverage = simul->GetData()->GetNetBetaAverage();
     
     IndividualPDPPBO* auxInd = dynamic_cast<IndividualPDPPBO*>(ind);
     auxInd->SetBlockProb(blockProb);
@@ -100,14 +100,14 @@ ResAllocOrder GA_RsaOrder::GetBoolDistribution() {
     return (ResAllocOrder) boolDistribution(this->random_generator);
 }
 
-void GA_RsaOrder::ApplyIndividual(Individual* ind) {
+void GA_RsaOrder::ApplyIndividual(Individual* ind, SimulationType* simul) {
     IndividualBool* indBool = dynamic_cast<IndividualBool*>(ind);
-    this->GetSimul()->GetResourceAlloc()
+    simul->GetResourceAlloc()
         ->SetResourceAllocOrder(indBool->GetGenes());
 }
 
-void GA_RsaOrder::SetIndParameters(Individual* ind) {
-    double blockProb = this->GetSimul()->GetData()->GetReqBP();
+void GA_RsaOrder::SetIndParameters(Individual* ind, SimulationType* simul) {
+    double blockProb = simul->GetData()->GetReqBP();
     IndividualBool* indBool = dynamic_cast<IndividualBool*>(ind);
     
     indBool->SetBlockProb(blockProb);
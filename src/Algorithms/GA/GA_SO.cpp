@@ -135,42 +135,30 @@ Individual* GA_SO::RouletteIndividual() {
 
 void GA_SO::RunSelectPop() {
     
-    for(auto it: this->selectedPopulation){
-        this->ApplyIndividual(it.get());
-        this->GetSimul()->RunBase();
-        this->SetIndParameters(it.get());
-        this->GetSimul()->GetData()->Initialize();
-    }
+    this->RunPopulation(this->selectedPopulation, 
+    [](Individual*, unsigned int numRuns){
+        return numRuns == 0;
+    });
     this->SetSelectedPopFitness();
 }
 
 void GA_SO::RunTotalPop() {
     unsigned int maxNumSimulPerInd = this->GetMaxNumSimulation();
     
-    for(auto it: this->totalPopulation){
-        
-        if(it->GetCount() < maxNumSimulPerInd){
-            this->ApplyIndividual(it.get());
-            this->GetSimul()->RunBase();
-            this->SetIndParameters(it.get());
-        }
-        this->GetSimul()->GetData()->Initialize();
-    }
+    this->RunPopulation(this->totalPopulation, 
+    [maxNumSimulPerInd](Individual* ind, unsigned int numRuns){
+        return numRuns == 0 && ind->GetCount() < maxNumSimulPerInd;
+    });
     this->SetTotalPopFitness();
 }
 
 void GA_SO::CheckMinSimul() {
     unsigned int maxNumSimulPerInd = this->GetMaxNumSimulation();
     
-    for(auto it: this->totalPopulation){
-        
-        while(it->GetCount() < maxNumSimulPerInd){
-            this->ApplyIndividual(it.get());
-            this->GetSimul()->RunBase();
-            this->SetIndParameters(it.get());
-            this->GetSimul()->GetData()->Initialize();
-        }
-    }
+    this->RunPopulation(this->totalPopulation, 
+    [maxNumSimulPerInd](Individual* ind, unsigned int){
+        return ind->GetCount() < maxNumSimulPerInd;
+    });
     this->SetTotalPopFitness();
 }
 
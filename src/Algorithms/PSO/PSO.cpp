@@ -19,8 +19,6 @@
 #include "../../../include/Data/Options.h"
 #include "../../../include/SimulationType/SimulationType.h"
 
-std::default_random_engine PSO::random_engine(Def::randomDevice());
-
 std::ostream& operator<<(std::ostream& ostream, const PSO* pso) {
     ostream << "Iteration: " << pso->actualIteration << std::endl;
     ostream << "Best particle: " << pso->GetBestParticle() << std::endl;
@@ -32,7 +30,8 @@ PSO::PSO(SimulationType* simul)
 :simul(simul), options(nullptr), loadPoint(0.0), actualIteration(0), 
 numberIterations(0), numberParticles(0), numberDimensions(0), minPosition(0.0), 
 maxPosition(0.0), minVelocity(0.0), maxVelocity(0.0), particles(0), 
-bestParticles(0) {
+bestParticles(0), 
+random_engine(simul->GetRandomStreams()->GetEngine(StreamPSO)) {
     
 }
 
@@ -46,7 +46,8 @@ Call::Call(Node* orNode, Node* deNode, double bitRate, TIME deacTime)
          firstSlot(Def::Max_UnInt), lastSlot(Def::Max_UnInt), numberSlots(0),
          totalNumSlots(0), core(Def::Max_UnInt), osnrTh(0.0), bandwidth(0.0),
          bitRate(bitRate), modulation(InvalidModulation), trialModulation(0),
-         deactivationTime(deacTime), route(nullptr), trialRoutes(0), trialProtRoutes(0) {
+         deactivationTime(deacTime), route(nullptr), trialRoutes(0), trialProtRoutes(0),
+         protectionCall(false), callAllocatedType(ocupada) {
     resources = orNode->GetTopology()->GetSimulType()->GetResourceAlloc()->
             GetResources();
 }
@@ -56,7 +57,8 @@ Call::Call(Node* orNode, Node* deNode, double bitRate, TIME deacTime, bool prote
          firstSlot(Def::Max_UnInt), lastSlot(Def::Max_UnInt), numberSlots(0),
          totalNumSlots(0), core(Def::Max_UnInt), osnrTh(0.0), bandwidth(0.0),
          bitRate(bitRate), modulation(InvalidModulation), trialModulation(0),
-         deactivationTime(deacTime), protectionCall(protectionCall), route(nullptr), trialRoutes(0), trialProtRoutes(0) {
+         deactivationTime(deacTime), protectionCall(protectionCall), route(nullptr), trialRoutes(0), trialProtRoutes(0),
+         callAllocatedType(ocupada) {
     resources = orNode->GetTopology()->GetSimulType()->GetResourceAlloc()->
             GetResources();
 }
@@ -225,7 +227,8 @@ std::shared_ptr<Route> Call::GetProtRoute(unsigned int routeIndex,
     return this->trialProtRoutes.at(routeIndex).at(protRouteIndex);
 }
 
-std::deque<std::shared_ptr<Route> > Call::GetProtRoutes(unsigned int routeIndex)  {
+const std::deque<std::shared_ptr<Route> >& Call::GetProtRoutes(
+unsigned int routeIndex) const {
     assert(routeIndex < this->trialRoutes.size());
 
     return this->trialProtRoutes.at(routeIndex);
@@ -248,29 +251,29 @@ void Call::PushTrialRoute(std::shared_ptr<Route> route) {
     this->trialRoutes.push_back(route);
 }
 
-void Call::PushTrialRoutes(std::vector<std::shared_ptr<Route> > routes) {
+void Call::PushTrialRoutes(const std::vector<std::shared_ptr<Route> >& 
+routes) {
 
-    for(auto it : routes)
+    for(auto& it : routes)
         if(it != nullptr)
             this->trialRoutes.push_back(it);
-    routes.clear();
 }
 
-void Call::PushTrialProtRoutes(std::vector<std::shared_ptr<Route>> routes) {
+void Call::PushTrialProtRoutes(const std::vector<std::shared_ptr<Route>>& 
+routes) {
     NodeIndex orNode = this->GetOrNode()->GetNodeId();
     NodeIndex deNode = this->GetDeNode()->GetNodeId();
-    std::vector<std::shared_ptr<Route>> protRoutes;
     unsigned int numRoutes = routes.size();
     this->trialProtRoutes.resize(numRoutes);
 
     for(unsigned int a = 0; a < routes.size(); a++){
-        protRoutes = resources->GetProtRoutes(orNode, deNode, a);
+        const std::vector<std::shared_ptr<Route>>& protRoutes = 
+        resources->GetProtRoutes(orNode, deNode, a);
 
-        for(auto it : protRoutes)
+        for(auto& it : protRoutes)
             this->trialProtRoutes.at(a).push_back(it);
 
     }
-    routes.clear();
 }
 
 void Call::ClearTrialRoutes() {
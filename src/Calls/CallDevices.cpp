@@ -95,12 +95,11 @@ void CallDevices::SetTotalNumSlots() {
         Call::SetTotalNumSlots();
 }
 
-std::vector<std::shared_ptr<Regenerator> > CallDevices::GetRegenerators() const{
+std::vector<Regenerator*> CallDevices::GetRegenerators() const{
     return regenerators;
 }
 
-void CallDevices::SetRegenerators(std::vector<std::shared_ptr<Regenerator> > 
-regenerators) {
+void CallDevices::SetRegenerators(std::vector<Regenerator*> regenerators) {
     assert(this->regenerators.empty());
     this->regenerators = regenerators;
 }
@@ -119,12 +118,11 @@ bool CallDevices::CheckUseRegeneration() const {
     return useRegeneration;
 }
 
-std::vector<std::shared_ptr<BVT>> CallDevices::GetTransponders() const {
+std::vector<BVT*> CallDevices::GetTransponders() const {
     return transponders;
 }
 
-void CallDevices::SetTransponders(std::vector<std::shared_ptr<BVT>> 
-transponders) {
+void CallDevices::SetTransponders(std::vector<BVT*> transponders) {
     this->transponders = transponders;
 }
 
@@ -38,7 +38,7 @@ std::ostream& operator<<(std::ostream& ostream, const Event* event){
 
 Event::Event(EventGenerator* generator, std::shared_ptr<Call> call, TIME time)
 :parGenerator(generator), eventType(CallRequest), eventTime(time),
-call(call) {
+call(call), index(0) {
 
 }
 
@@ -46,6 +46,12 @@ Event::~Event() {
     this->call.reset();
 }
 
+void Event::Initialize(std::shared_ptr<Call> call, TIME time) {
+    this->eventType = CallRequest;
+    this->eventTime = time;
+    this->call = call;
+}
+
 EventType Event::GetEventType() const {
     return eventType;
 }
@@ -72,10 +78,22 @@ Call* Event::GetCall() const {
     return this->call.get();
 }
 
+std::shared_ptr<Call> Event::GetSharedCall() const {
+    return this->call;
+}
+
 void Event::SetCall(std::shared_ptr<Call> call) {
     this->call = call;
 }
 
+EventIndex Event::GetIndex() const {
+    return index;
+}
+
+void Event::SetIndex(EventIndex index) {
+    this->index = index;
+}
+
 void Event::ImplementEvent() {
     
     switch(this->eventType){
@@ -106,10 +124,10 @@ void Event::ImplementCallRequest() {
             this->SetEventType(CallEnd);
             this->SetEventTime(this->parGenerator->GetSimulationTime() + 
                                this->call->GetDeactivationTime());
-            this->parGenerator->PushEvent(shared_from_this());
+            this->parGenerator->PushEvent(this);
             break;
         case Blocked:
-            call.reset();
+            this->parGenerator->ReleaseEvent(this);
             break;
         default:
             std::cerr << "Invalid Call status" << std::endl;
@@ -121,4 +139,5 @@ void Event::ImplementCallEnd() {
     assert(this->call->GetStatus() == Accepted);
     
     this->parGenerator->GetTopology()->Release(this->call.get());
+    this->parGenerator->ReleaseEvent(this);
 }
@@ -11,29 +11,29 @@
  * Created on August 17, 2018, 10:53 PM
  */
 
+#include <boost/make_unique.hpp>
+
 #include "../../include/Calls/EventGenerator.h"
 #include "../../include/Calls/Traffic.h"
 #include "../../include/Calls/Call.h"
 #include "../../include/Calls/CallDevices.h"
 #include "../../include/Calls/Event.h"
+#include "../../include/Calls/EventQueue.h"
+#include "../../include/Calls/EventTrace.h"
 #include "../../include/SimulationType/SimulationType.h"
 #include "../../include/Structure/Topology.h"
 #include "../../include/Data/Parameters.h"
 #include "../../include/Data/Data.h"
 #include "../../include/Data/Options.h"
-
-std::default_random_engine EventGenerator::random_generator(0);
-
-bool EventGenerator::EventCompare::operator()(
-        const std::shared_ptr<Event> eventA,
-        const std::shared_ptr<Event> eventB) const {
-
-    return (eventA->GetEventTime() > eventB->GetEventTime());
-}
+#include "../../include/Data/InputOutput.h"
+#include "../../include/GeneralClasses/RandomStreams.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 EventGenerator::EventGenerator(SimulationType* simulType)
         :simulType(simulType), topology(nullptr), data(nullptr), traffic(nullptr),
-         networkLoad(0.0), simulationTime(0.0) {
+         randomStreams(nullptr),
+         networkLoad(0.0), simulationTime(0.0), numberEvents(0),
+         queueEvents(boost::make_unique<EventQueue>()), eventTrace(nullptr) {
 
 }
 
@@ -46,6 +46,7 @@ void EventGenerator::Load() {
     this->data = this->GetSimulType()->GetData();
     this->traffic = this->GetSimulType()->GetTraffic();
     this->resourceAlloc = this->GetSimulType()->GetResourceAlloc();
+    this->randomStreams = this->GetSimulType()->GetRandomStreams();
 
     this->uniformNodeDistribution = std::uniform_int_distribution<int>
             (0, this->topology->GetNumNodes() - 1);
@@ -53,62 +54,96 @@ void EventGenerator::Load() {
             (0, this->traffic->GetVecTraffic().size() - 1);
     this->exponencialMuDistribution = std::exponential_distribution<TIME>
             (1.0L / this->simulType->GetParameters()->GetMu());
-
-    this->LoadRandomGenerator();
+    this->uniformProtectionDistribution = 
+            std::uniform_int_distribution<int>(0, 9);
+    
+    if(this->simulType->GetOptions()->GetTraceOption() != TraceDisabled)
+        this->eventTrace = boost::make_unique<EventTrace>(
+        this->topology->GetNumNodes(), this->traffic->GetVecTraffic().size());
 }
 
 void EventGenerator::Initialize() {
     this->InitializeGenerator();
+    this->InitializeTrace();
     this->simulationTime = 0.0;
+    this->numberEvents = 0;
     this->exponencialHDistribution = std::exponential_distribution<TIME>
             (this->networkLoad);
-    this->SetRealSimulationTime((TIME) std::clock() / CLOCKS_PER_SEC);
+    this->SetRealSimulationTime(std::chrono::duration<TIME>(
+    std::chrono::steady_clock::now().time_since_epoch()).count());
 }
 
 void EventGenerator::Finalize() {
-    this->SetRealSimulationTime(((TIME) std::clock() / CLOCKS_PER_SEC) -
-                                this->GetRealSimulationTime());
+    this->SetRealSimulationTime(std::chrono::duration<TIME>(
+    std::chrono::steady_clock::now().time_since_epoch()).count() -
+    this->GetRealSimulationTime());
     this->data->SetRealSimulTime(this->GetRealSimulationTime());
 
-    while(!this->queueEvents.empty()){
-        this->queueEvents.pop();
-    }
+    this->queueEvents->Clear();
+    
+    if(this->eventTrace)
+        this->eventTrace->Close();
+}
+
+void EventGenerator::FinalizeWarmUp() {
+    this->queueEvents->Clear();
 }
 
 void EventGenerator::GenerateCall() {
     std::shared_ptr<Call> newCall;
-    unsigned int auxIndexOrNode = uniformNodeDistribution(random_generator);
-    unsigned int auxIndexDeNode;
-
-    do{
-        auxIndexDeNode = uniformNodeDistribution(random_generator);
-    }while(auxIndexOrNode == auxIndexDeNode);
-
-    unsigned int auxIndexTraffic =
-            uniformTrafficDistribution(random_generator);
-
-    TIME arrivalTime = exponencialHDistribution(random_generator);
-    TIME deactvationTime = exponencialMuDistribution(random_generator);
-
-    std::random_device rd;   // non-deterministic generator
-    std::mt19937 gen(rd());  // to seed mersenne twister.
-    std::uniform_int_distribution<> dist(0,9);
-    int type = dist(gen);
-    bool typeCall;
-
-    if(type < 3){
-        typeCall = false;
-    }else{
-        typeCall = true;
-    };
+    TraceCall record;
+    
+    if(this->simulType->GetOptions()->GetTraceOption() == TraceReplay){
+        record = this->eventTrace->Read();
+    }
+    else{
+        RandomStreams::Engine& nodesEngine = 
+                randomStreams->GetEngine(StreamNodes);
+        
+        if(this->traffic->IsMatrixLoaded()){
+            unsigned int orNode, deNode, trafficIndex;
+            
+            this->traffic->DrawMatrixRequest(nodesEngine, orNode, deNode, 
+                                             trafficIndex);
+            record.orNode = orNode;
+            record.deNode = deNode;
+            record.traffic = trafficIndex;
+        }
+        else{
+            record.orNode = uniformNodeDistribution(nodesEngine);
+
+            do{
+                record.deNode = uniformNodeDistribution(nodesEngine);
+            }while(record.orNode == record.deNode);
+
+            record.traffic = uniformTrafficDistribution(
+                    randomStreams->GetEngine(StreamTraffic));
+        }
+        record.interArrivalTime = exponencialHDistribution(
+                randomStreams->GetEngine(StreamArrival));
+        record.holdingTime = exponencialMuDistribution(
+                randomStreams->GetEngine(StreamHolding));
+
+        int type = uniformProtectionDistribution(
+                randomStreams->GetEngine(StreamProtection));
+
+        if(type < 3){
+            record.protection = false;
+        }else{
+            record.protection = true;
+        };
+        record.unused = 0;
+        
+        if(this->eventTrace)
+            this->eventTrace->Write(record);
+    }
 
-    newCall = this->CreateCall(auxIndexOrNode, auxIndexDeNode, auxIndexTraffic,
-                               deactvationTime, typeCall);
+    newCall = this->CreateCall(record.orNode, record.deNode, record.traffic,
+                               record.holdingTime, record.protection);
 
     //Event creation from the call created before
-    std::shared_ptr<Event> newEvent =
-            std::make_shared<Event>(this, newCall, this->GetSimulationTime() +
-                                                   arrivalTime);
+    Event* newEvent = this->queueEvents->CreateEvent(this, newCall, 
+                      this->GetSimulationTime() + record.interArrivalTime);
 
     this->PushEvent(newEvent);
 }
@@ -131,16 +166,52 @@ void EventGenerator::SetSimulationTime(const TIME simulationTime) {
     this->simulationTime = simulationTime;
 }
 
-std::shared_ptr<Event> EventGenerator::GetNextEvent() {
-    std::shared_ptr<Event> nextEvent = this->queueEvents.top();
-    this->queueEvents.pop();
+Event* EventGenerator::GetNextEvent() {
+    PROFILE_SCOPE(PhaseEventQueue);
+    PROFILE_COUNT(CounterEvents, 1);
+    Event* nextEvent = this->queueEvents->Pop();
     this->SetSimulationTime(nextEvent->GetEventTime());
+    this->numberEvents++;
 
     return nextEvent;
 }
 
-void EventGenerator::PushEvent(std::shared_ptr<Event> evt) {
-    this->queueEvents.push(evt);
+void EventGenerator::PushEvent(Event* evt) {
+    PROFILE_SCOPE(PhaseEventQueue);
+    this->queueEvents->Push(evt);
+}
+
+void EventGenerator::ReleaseEvent(Event* evt) {
+    this->queueEvents->ReleaseEvent(evt);
+}
+
+std::vector<std::pair<TIME, std::shared_ptr<Call>>> 
+EventGenerator::GetActiveCalls() const {
+    std::vector<std::pair<TIME, std::shared_ptr<Call>>> activeCalls;
+    const Event* evt;
+    
+    for(unsigned int a = 0; a < this->queueEvents->GetNumEvents(); a++){
+        evt = this->queueEvents->GetEvent(a);
+        
+        if(evt->GetEventType() == CallEnd)
+            activeCalls.push_back(std::make_pair(evt->GetEventTime(), 
+                                                 evt->GetSharedCall()));
+    }
+    
+    return activeCalls;
+}
+
+void EventGenerator::SetActiveCalls(TIME simulationTime, 
+const std::vector<std::pair<TIME, std::shared_ptr<Call>>>& activeCalls) {
+    Event* evt;
+    this->queueEvents->Clear();
+    this->simulationTime = simulationTime;
+    
+    for(auto& it: activeCalls){
+        evt = this->queueEvents->CreateEvent(this, it.second, it.first);
+        evt->SetEventType(CallEnd);
+        this->PushEvent(evt);
+    }
 }
 
 SimulationType* EventGenerator::GetSimulType() const {
@@ -168,6 +239,10 @@ void EventGenerator::SetRealSimulationTime(TIME realSimullationTime) {
     this->realSimulationTime = realSimullationTime;
 }
 
+NumRequest EventGenerator::GetNumberEvents() const {
+    return numberEvents;
+}
+
 std::shared_ptr<Call> EventGenerator::CreateCall(unsigned orNodeIndex,
                                                  unsigned deNodeIndex, unsigned trafficIndex, TIME deactTime, bool protectionCall) {
     std::shared_ptr<Call> newCall;
@@ -192,25 +267,29 @@ std::shared_ptr<Call> EventGenerator::CreateCall(unsigned orNodeIndex,
     return newCall;
 }
 
-void EventGenerator::LoadRandomGenerator() {
+void EventGenerator::InitializeGenerator() {
+
+    if(simulType->GetOptions()->GetGenerationOption() == GenerationSame)
+        this->randomStreams->RestartSimulStreams(0);
+}
 
-    switch(simulType->GetOptions()->GetGenerationOption()){
-        case GenerationSame:
-        case GenerationPseudoRandom:
-            EventGenerator::random_generator = std::default_random_engine{0};
+void EventGenerator::InitializeTrace() {
+    std::string fileName;
+    
+    if(!this->eventTrace || this->eventTrace->IsOpen())
+        return;
+    fileName = this->simulType->GetInputOutput()->GetTraceName(
+    this->data->GetActualIndex(), this->randomStreams->GetReplication());
+    
+    switch(this->simulType->GetOptions()->GetTraceOption()){
+        case TraceRecord:
+            this->eventTrace->OpenRecord(fileName);
             break;
-        case GenerationRandom:
-            EventGenerator::random_generator =
-                    std::default_random_engine{Def::randomDevice()};
+        case TraceReplay:
+            this->eventTrace->OpenReplay(fileName);
             break;
         default:
-            std::cerr << "Invalid random generation option" << std::endl;
+            std::cerr << "Invalid request trace option" << std::endl;
             std::abort();
     }
 }
-
-void EventGenerator::InitializeGenerator() {
-
-    if(simulType->GetOptions()->GetGenerationOption() == GenerationSame)
-        EventGenerator::random_generator = std::default_random_engine{0};
-}
\ No newline at end of file
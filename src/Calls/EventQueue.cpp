@@ -0,0 +1,132 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   EventQueue.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 3:24 PM
+ */
+
+#include <algorithm>
+
+#include "../../include/Calls/EventQueue.h"
+
+const unsigned int EventQueue::arity = 4;
+
+EventQueue::EventQueue()
+:freeEvents(0), heap(0) {
+    
+}
+
+EventQueue::~EventQueue() {
+    
+}
+
+Event* EventQueue::CreateEvent(EventGenerator* generator, 
+std::shared_ptr<Call> call, TIME time) {
+    Event* evt;
+    
+    if(freeEvents.empty()){
+        events.emplace_back(generator, call, time);
+        evt = &events.back();
+        evt->SetIndex(events.size() - 1);
+    }
+    else{
+        evt = &events.at(freeEvents.back());
+        freeEvents.pop_back();
+        evt->Initialize(call, time);
+    }
+    
+    return evt;
+}
+
+void EventQueue::ReleaseEvent(Event* evt) {
+    assert(&events.at(evt->GetIndex()) == evt);
+    
+    evt->SetCall(nullptr);
+    freeEvents.push_back(evt->GetIndex());
+}
+
+void EventQueue::Push(Event* evt) {
+    HeapEntry entry;
+    entry.time = evt->GetEventTime();
+    entry.index = evt->GetIndex();
+    
+    heap.push_back(entry);
+    this->SiftUp(heap.size() - 1);
+}
+
+Event* EventQueue::Pop() {
+    assert(!heap.empty());
+    Event* evt = &events[heap.front().index];
+    
+    heap.front() = heap.back();
+    heap.pop_back();
+    
+    if(!heap.empty())
+        this->SiftDown(0);
+    
+    return evt;
+}
+
+bool EventQueue::IsEmpty() const {
+    return heap.empty();
+}
+
+unsigned int EventQueue::GetNumEvents() const {
+    return heap.size();
+}
+
+const Event* EventQueue::GetEvent(unsigned int pos) const {
+    assert(pos < heap.size());
+    
+    return &events[heap[pos].index];
+}
+
+void EventQueue::Clear() {
+    
+    for(auto it: heap)
+        this->ReleaseEvent(&events[it.index]);
+    heap.clear();
+}
+
+void EventQueue::SiftUp(unsigned int pos) {
+    HeapEntry entry = heap[pos];
+    unsigned int parent;
+    
+    while(pos > 0){
+        parent = (pos - 1) / arity;
+        
+        if(heap[parent].time <= entry.time)
+            break;
+        heap[pos] = heap[parent];
+        pos = parent;
+    }
+    heap[pos] = entry;
+}
+
+void EventQueue::SiftDown(unsigned int pos) {
+    HeapEntry entry = heap[pos];
+    unsigned int size = heap.size();
+    unsigned int child, lastChild, minChild;
+    
+    while((child = pos * arity + 1) < size){
+        lastChild = std::min(child + arity, size);
+        minChild = child;
+        
+        for(++child; child < lastChild; ++child){
+            if(heap[child].time < heap[minChild].time)
+                minChild = child;
+        }
+        
+        if(entry.time <= heap[minChild].time)
+            break;
+        heap[pos] = heap[minChild];
+        pos = minChild;
+    }
+    heap[pos] = entry;
+}
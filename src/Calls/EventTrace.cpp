@@ -0,0 +1,168 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   EventTrace.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:14 PM
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+#include "../../include/Calls/EventTrace.h"
+
+const std::uint32_t EventTrace::version = 1;
+
+//File signature, followed by the header fields.
+static const char traceSignature[8] = {'O', 'N', 'S', 'T', 'R', 'A', 'C', 'E'};
+
+/**
+ * @brief Header of the trace file. Its size keeps the records aligned.
+ */
+struct TraceHeader {
+    char signature[8];
+    std::uint32_t version;
+    std::uint32_t numNodes;
+    std::uint32_t numTraffic;
+    std::uint32_t recordSize;
+};
+
+static_assert(sizeof(TraceCall) == 24, "Unexpected trace record size");
+static_assert(sizeof(TraceHeader) % alignof(TraceCall) == 0,
+              "Unaligned trace records");
+
+//Number of records written at once in the record mode.
+static const std::size_t traceBlockSize = 4096;
+
+EventTrace::EventTrace(unsigned int numNodes, unsigned int numTraffic)
+:numNodes(numNodes), numTraffic(numTraffic), fileName(), tempName(), file(),
+buffer(0), mapping(), region(), records(nullptr), numRecords(0),
+nextRecord(0) {
+
+}
+
+EventTrace::~EventTrace() {
+    this->Close();
+}
+
+void EventTrace::OpenRecord(const std::string& fileName) {
+    TraceHeader header;
+    this->Close();
+
+    this->fileName = fileName;
+    this->tempName = fileName + "." + std::to_string(std::random_device()())
+                     + ".tmp";
+    file.open(tempName, std::ios::binary | std::ios::trunc);
+
+    if(!file.is_open()){
+        std::cerr << "Unable to write the trace file: " << fileName
+                  << std::endl;
+        std::abort();
+    }
+
+    std::memcpy(header.signature, traceSignature, sizeof(traceSignature));
+    header.version = version;
+    header.numNodes = numNodes;
+    header.numTraffic = numTraffic;
+    header.recordSize = sizeof(TraceCall);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    buffer.reserve(traceBlockSize);
+}
+
+void EventTrace::OpenReplay(const std::string& fileName) {
+    const TraceHeader* header;
+    this->Close();
+
+    try{
+        mapping = boost::interprocess::file_mapping(fileName.c_str(),
+                  boost::interprocess::read_only);
+        region = boost::interprocess::mapped_region(mapping,
+                 boost::interprocess::read_only);
+    }
+    catch(const boost::interprocess::interprocess_exception&){
+        std::cerr << "Unable to read the trace file: " << fileName
+                  << std::endl;
+        std::abort();
+    }
+    header = static_cast<const TraceHeader*>(region.get_address());
+
+    if(region.get_size() < sizeof(TraceHeader) ||
+    std::memcmp(header->signature, traceSignature,
+                sizeof(traceSignature)) != 0 ||
+    header->version != version || header->numNodes != numNodes ||
+    header->numTraffic != numTraffic ||
+    header->recordSize != sizeof(TraceCall) ||
+    (region.get_size() - sizeof(TraceHeader)) % sizeof(TraceCall) != 0){
+        std::cerr << "Invalid trace file: " << fileName << std::endl;
+        std::abort();
+    }
+
+    this->fileName = fileName;
+    records = reinterpret_cast<const TraceCall*>(header + 1);
+    numRecords = (region.get_size() - sizeof(TraceHeader)) /
+                 sizeof(TraceCall);
+    nextRecord = 0;
+}
+
+void EventTrace::Close() {
+
+    if(file.is_open()){
+        this->Flush();
+        file.close();
+
+        if(!file || std::rename(tempName.c_str(), fileName.c_str()) != 0){
+            std::cerr << "Unable to write the trace file: " << fileName
+                      << std::endl;
+            std::remove(tempName.c_str());
+        }
+    }
+    region = boost::interprocess::mapped_region();
+    mapping = boost::interprocess::file_mapping();
+    records = nullptr;
+    numRecords = 0;
+    nextRecord = 0;
+}
+
+bool EventTrace::IsOpen() const {
+    return (file.is_open() || records != nullptr);
+}
+
+void EventTrace::Write(const TraceCall& record) {
+    buffer.push_back(record);
+
+    if(buffer.size() == traceBlockSize)
+        this->Flush();
+}
+
+const TraceCall& EventTrace::Read() {
+
+    if(nextRecord == numRecords){
+        std::cerr << "The trace file ended before the simulation: "
+                  << fileName << std::endl;
+        std::abort();
+    }
+    const TraceCall& record = records[nextRecord++];
+
+    if(record.orNode >= numNodes || record.deNode >= numNodes ||
+    record.orNode == record.deNode || record.traffic >= numTraffic){
+        std::cerr << "Invalid call request in the trace file: " << fileName
+                  << std::endl;
+        std::abort();
+    }
+
+    return record;
+}
+
+void EventTrace::Flush() {
+    file.write(reinterpret_cast<const char*>(buffer.data()),
+               buffer.size() * sizeof(TraceCall));
+    buffer.clear();
+}
@@ -12,14 +12,26 @@
  */
 
 #include <fstream>
+#include <sstream>
+#include <iterator>
+#include <random>
+#include <cstring>
+#include <cstdio>
 
 #include "../../include/Calls/Traffic.h"
 
 #include "../../include/SimulationType/SimulationType.h"
+#include "../../include/Structure/Topology.h"
 #include "../../include/Data/InputOutput.h"
 #include "../../include/Data/Options.h"
 #include "../../include/GeneralClasses/Def.h"
 
+const std::uint32_t Traffic::matrixVersion = 1;
+
+//File signature of the binary traffic matrix, followed by the header fields.
+static const char matrixSignature[8] = {'O', 'N', 'S', 'M', 'A', 'T', 'R', 
+                                        'X'};
+
 std::ostream& operator<<(std::ostream& ostream, 
 const Traffic* traffic) {
     unsigned int size = traffic->GetVecTraffic().size();
@@ -35,7 +47,8 @@ const Traffic* traffic) {
 }
 
 Traffic::Traffic(SimulationType* simulType)
-:simulType(simulType), vecTraffic(0) {
+:simulType(simulType), vecTraffic(0), matrixNumNodes(0), matrixEntries(0),
+matrixTable() {
 }
 
 Traffic::Traffic(const Traffic& orig) {
@@ -56,6 +69,36 @@ void Traffic::LoadFile() {
         auxIfstream >> auxDouble;
         vecTraffic.push_back(auxDouble);
     }
+    
+    switch(this->simulType->GetOptions()->GetTrafficMatrixOption()){
+        case TrafficMatrixUniform:
+            break;
+        case TrafficMatrixText:
+            this->LoadMatrixText();
+            break;
+        case TrafficMatrixBinary:
+            this->LoadMatrixBinary();
+            break;
+        default:
+            std::cerr << "Invalid traffic matrix option" << std::endl;
+            std::abort();
+    }
+}
+
+bool Traffic::IsMatrixLoaded() const {
+    return !this->matrixEntries.empty();
+}
+
+void Traffic::DrawMatrixRequest(RandomStreams::Engine& engine, 
+unsigned int& orNode, unsigned int& deNode, unsigned int& trafficIndex) 
+const {
+    unsigned int position = this->matrixEntries[this->matrixTable.Draw(
+                            engine)];
+    
+    trafficIndex = position % this->vecTraffic.size();
+    position /= this->vecTraffic.size();
+    deNode = position % this->matrixNumNodes;
+    orNode = position / this->matrixNumNodes;
 }
 
 std::vector<double> Traffic::GetVecTraffic() const {
@@ -80,3 +123,170 @@ unsigned int Traffic::GetTrafficIndex(double bitRate) const{
     
     return Def::Max_UnInt;
 }
+
+void Traffic::LoadMatrixText() {
+    std::string fileName = this->simulType->GetInputOutput()->
+                           GetTrafficMatrixName(false);
+    std::ifstream auxIfstream;
+    unsigned int numNodes, numClasses, orNode, deNode;
+    double rate, sumShares;
+    std::vector<double> shares;
+    std::vector<float> matrix;
+    bool validLine;
+    
+    this->simulType->GetInputOutput()->LoadTrafficMatrix(auxIfstream, false);
+    
+    if(!(auxIfstream >> numNodes >> numClasses)){
+        std::cerr << "Invalid traffic matrix file: " << fileName << std::endl;
+        std::abort();
+    }
+    this->CheckMatrixSize(numNodes, numClasses, fileName);
+    matrix.assign(numNodes * numNodes * numClasses, 0.0f);
+    shares.resize(numClasses);
+    
+    while(auxIfstream >> orNode >> deNode >> rate){
+        validLine = (orNode < numNodes && deNode < numNodes && 
+                     orNode != deNode && rate >= 0.0);
+        sumShares = 0.0;
+        
+        for(unsigned int c = 0; c < numClasses; c++){
+            auxIfstream >> shares.at(c);
+            validLine = validLine && shares.at(c) >= 0.0;
+            sumShares += shares.at(c);
+        }
+        
+        if(!auxIfstream || !validLine || sumShares <= 0.0){
+            std::cerr << "Invalid node pair in the traffic matrix file: " 
+                      << fileName << std::endl;
+            std::abort();
+        }
+        
+        for(unsigned int c = 0; c < numClasses; c++)
+            matrix.at((orNode * numNodes + deNode) * numClasses + c) += 
+            rate * shares.at(c) / sumShares;
+    }
+    
+    if(!auxIfstream.eof()){
+        std::cerr << "Invalid traffic matrix file: " << fileName << std::endl;
+        std::abort();
+    }
+    this->CreateMatrixTable(matrix, numNodes, fileName);
+    this->SaveMatrixBinary(matrix, numNodes);
+}
+
+void Traffic::LoadMatrixBinary() {
+    std::string fileName = this->simulType->GetInputOutput()->
+                           GetTrafficMatrixName(true);
+    std::ifstream auxIfstream;
+    char signature[sizeof(matrixSignature)];
+    std::uint32_t version, numNodes, numClasses;
+    std::vector<float> matrix;
+    
+    this->simulType->GetInputOutput()->LoadTrafficMatrix(auxIfstream, true);
+    auxIfstream.read(signature, sizeof(signature));
+    auxIfstream.read(reinterpret_cast<char*>(&version), sizeof(version));
+    auxIfstream.read(reinterpret_cast<char*>(&numNodes), sizeof(numNodes));
+    auxIfstream.read(reinterpret_cast<char*>(&numClasses), 
+                     sizeof(numClasses));
+    
+    if(!auxIfstream || std::memcmp(signature, matrixSignature, 
+    sizeof(matrixSignature)) != 0 || version != matrixVersion){
+        std::cerr << "Invalid traffic matrix file: " << fileName << std::endl;
+        std::abort();
+    }
+    this->CheckMatrixSize(numNodes, numClasses, fileName);
+    matrix.resize(numNodes * numNodes * numClasses);
+    auxIfstream.read(reinterpret_cast<char*>(matrix.data()), 
+                     matrix.size() * sizeof(float));
+    
+    if(!auxIfstream){
+        std::cerr << "Invalid traffic matrix file: " << fileName << std::endl;
+        std::abort();
+    }
+    this->CreateMatrixTable(matrix, numNodes, fileName);
+}
+
+void Traffic::SaveMatrixBinary(const std::vector<float>& matrix, 
+unsigned int numNodes) const {
+    std::string fileName = this->simulType->GetInputOutput()->
+                           GetTrafficMatrixName(true);
+    std::uint32_t version = matrixVersion, auxNumNodes = numNodes, 
+                  numClasses = this->vecTraffic.size();
+    std::ostringstream content;
+    
+    content.write(matrixSignature, sizeof(matrixSignature));
+    content.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    content.write(reinterpret_cast<const char*>(&auxNumNodes), 
+                  sizeof(auxNumNodes));
+    content.write(reinterpret_cast<const char*>(&numClasses), 
+                  sizeof(numClasses));
+    content.write(reinterpret_cast<const char*>(matrix.data()), 
+                  matrix.size() * sizeof(float));
+    
+    //The binary file is kept if it already holds this matrix.
+    std::ifstream oldIfstream(fileName, std::ios::binary);
+    if(oldIfstream.is_open() && std::string(
+    std::istreambuf_iterator<char>(oldIfstream), 
+    std::istreambuf_iterator<char>()) == content.str())
+        return;
+    oldIfstream.close();
+    
+    std::string tempName = fileName + "." + 
+                           std::to_string(std::random_device()()) + ".tmp";
+    std::ofstream auxOfstream(tempName, std::ios::binary | std::ios::trunc);
+    auxOfstream << content.str();
+    auxOfstream.close();
+    
+    //The file is renamed only when complete, so the simulations running at 
+    //the same time do not read a partial matrix.
+    if(!auxOfstream || std::rename(tempName.c_str(), fileName.c_str()) != 0){
+        std::cerr << "Unable to write the traffic matrix file: " << fileName
+                  << std::endl;
+        std::remove(tempName.c_str());
+    }
+}
+
+void Traffic::CheckMatrixSize(unsigned int numNodes, unsigned int numClasses,
+const std::string& fileName) const {
+    
+    if(numNodes != this->simulType->GetTopology()->GetNumNodes() || 
+    numClasses != this->vecTraffic.size()){
+        std::cerr << "The traffic matrix does not match the topology and "
+                  << "traffic: " << fileName << std::endl;
+        std::abort();
+    }
+}
+
+void Traffic::CreateMatrixTable(const std::vector<float>& matrix, 
+unsigned int numNodes, const std::string& fileName) {
+    unsigned int numClasses = this->vecTraffic.size();
+    std::vector<double> weights;
+    unsigned int node;
+    
+    this->matrixNumNodes = numNodes;
+    this->matrixEntries.clear();
+    
+    for(unsigned int a = 0; a < matrix.size(); a++){
+        node = a / numClasses;
+        
+        //Also rejects NaN rates, and requests from a node to itself.
+        if(!(matrix[a] >= 0.0f) || 
+        (matrix[a] > 0.0f && node / numNodes == node % numNodes)){
+            std::cerr << "Invalid arrival rate in the traffic matrix file: "
+                      << fileName << std::endl;
+            std::abort();
+        }
+        
+        if(matrix[a] > 0.0f){
+            this->matrixEntries.push_back(a);
+            weights.push_back(matrix[a]);
+        }
+    }
+    
+    if(weights.empty()){
+        std::cerr << "The traffic matrix has no call requests: " << fileName
+                  << std::endl;
+        std::abort();
+    }
+    this->matrixTable.Create(weights);
+}
@@ -11,18 +11,25 @@
  * Created on August 8, 2018, 6:25 PM
  */
 
+#include <cmath>
+#include <numeric>
+#include <algorithm>
+
 #include "../../include/Data/Data.h"
 #include "../../include/Data/InputOutput.h"
 #include "../../include/Data/Parameters.h"
 #include "../../include/Data/Options.h"
+#include "../../include/Data/ResultWriter.h"
 #include "../../include/SimulationType/SimulationType.h"
 #include "../../include/SimulationType/SimulationGA.h"
 #include "../../include/SimulationType/SimulationPSO.h"
 #include "../../include/Calls/Call.h"
+#include "../../include/Calls/CallDevices.h"
 #include "../../include/ResourceAllocation/Route.h"
 #include "../../include/Algorithms/Algorithms.h"
 #include "../../include/Structure/Topology.h"
 #include "../../include/Algorithms/GA/IndividualPDPPBO.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 std::ostream& operator<<(std::ostream& ostream, 
 const Data* data) {
@@ -55,6 +62,15 @@ const Data* data) {
             << "  BetaAvrg:" << data->GetNetBetaAverage()
             << "   AlphaAvrg:" << data->GetNetAlphaAverage() << std::endl;
     
+    if(data->GetNumReplications() > 1){
+        ostream << "Replications:" << data->GetNumReplications()
+                << "  ReqBP mean:" << data->GetReplicMean(ReplicReqBP)
+                << "  CI95:" << data->GetReplicConfInterval(ReplicReqBP)
+                << "  SlotsBP mean:" << data->GetReplicMean(ReplicSlotsBP)
+                << "  CI95:" << data->GetReplicConfInterval(ReplicSlotsBP)
+                << std::endl;
+    }
+    
     return ostream;
 }
 
@@ -65,7 +81,7 @@ Data::Data(SimulationType* simulType)
   netFragmentationRatio(0), accumNetFragmentationRatio(0) , fragPerTraffic(0),
   linksUse(0), slotsRelativeUse(0), simulTime(0), realSimulTime(0),
   actualIndex(0), protectedCalls(0), nonProtectedCalls(0), sumCallsBetaAverage(0),
-  sumCallsAlpha(0){
+  sumCallsAlpha(0), replicValues(0), replicPending(0){
     
 }
 
@@ -102,6 +118,9 @@ void Data::Initialize() {
     nonProtectedCalls.resize(size);
     sumCallsBetaAverage.resize(size);
     sumCallsAlpha.resize(size);
+    replicValues.assign(size, std::vector<std::vector<double>>(
+                        LastReplicMetric + 1));
+    replicPending.assign(size, std::map<unsigned int, std::vector<double>>());
 }
 
 void Data::Initialize(unsigned int numPos) {
@@ -126,9 +145,90 @@ void Data::Initialize(unsigned int numPos) {
     nonProtectedCalls.resize(numPos);
     sumCallsBetaAverage.resize(numPos);
     sumCallsAlpha.resize(numPos);
+    replicValues.assign(numPos, std::vector<std::vector<double>>(
+                        LastReplicMetric + 1));
+    replicPending.assign(numPos, 
+                         std::map<unsigned int, std::vector<double>>());
+}
+
+void Data::CopyPoint(const Data* data, unsigned int index) {
+    assert(index < numberReq.size() && index < data->numberReq.size());
+    
+    numberReq.at(index) = data->numberReq.at(index);
+    numberBlocReq.at(index) = data->numberBlocReq.at(index);
+    numberAccReq.at(index) = data->numberAccReq.at(index);
+    numberSlotsReq.at(index) = data->numberSlotsReq.at(index);
+    numberBlocSlots.at(index) = data->numberBlocSlots.at(index);
+    numberAccSlots.at(index) = data->numberAccSlots.at(index);
+    numberAccSlotsInt.at(index) = data->numberAccSlotsInt.at(index);
+    numHopsPerRoute.at(index) = data->numHopsPerRoute.at(index);
+    netOccupancy.at(index) = data->netOccupancy.at(index);
+    accReqUtilization.at(index) = data->accReqUtilization.at(index);
+    netFragmentationRatio.at(index) = data->netFragmentationRatio.at(index);
+    accumNetFragmentationRatio.at(index) = 
+    data->accumNetFragmentationRatio.at(index);
+    fragPerTraffic.at(index) = data->fragPerTraffic.at(index);
+    linksUse.at(index) = data->linksUse.at(index);
+    slotsRelativeUse.at(index) = data->slotsRelativeUse.at(index);
+    protectedCalls.at(index) = data->protectedCalls.at(index);
+    nonProtectedCalls.at(index) = data->nonProtectedCalls.at(index);
+    sumCallsBetaAverage.at(index) = data->sumCallsBetaAverage.at(index);
+    sumCallsAlpha.at(index) = data->sumCallsAlpha.at(index);
+    simulTime.at(index) = data->simulTime.at(index);
+    realSimulTime.at(index) = data->realSimulTime.at(index);
+}
+
+void Data::ClearPoint(unsigned int index) {
+    assert(index < numberReq.size());
+    
+    numberReq.at(index) = 0.0;
+    numberBlocReq.at(index) = 0.0;
+    numberAccReq.at(index) = 0.0;
+    numberSlotsReq.at(index) = 0.0;
+    numberBlocSlots.at(index) = 0.0;
+    numberAccSlots.at(index) = 0.0;
+    numberAccSlotsInt.at(index) = 0;
+    numHopsPerRoute.at(index) = 0.0;
+    netOccupancy.at(index) = 0.0;
+    accReqUtilization.at(index) = 0.0;
+    netFragmentationRatio.at(index) = 0.0;
+    accumNetFragmentationRatio.at(index).clear();
+    fragPerTraffic.at(index).clear();
+    linksUse.at(index).clear();
+    slotsRelativeUse.at(index).assign(slotsRelativeUse.at(index).size(), 0.0);
+    protectedCalls.at(index) = 0.0;
+    nonProtectedCalls.at(index) = 0.0;
+    sumCallsBetaAverage.at(index) = 0.0;
+    sumCallsAlpha.at(index) = 0.0;
+    simulTime.at(index) = 0.0;
+    realSimulTime.at(index) = 0.0;
+}
+
+void Data::AddReplication(const Data* data, unsigned int replication) {
+    std::vector<std::vector<double>>& values = 
+    replicValues.at(data->GetActualIndex());
+    std::map<unsigned int, std::vector<double>>& pending = 
+    replicPending.at(data->GetActualIndex());
+    double precision = this->simulType->GetParameters()->
+    GetReplicationsPrecision();
+    assert(data->GetActualIndex() == this->actualIndex);
+    
+    pending[replication] = {data->GetReqBP(), data->GetSlotsBP(), 
+    data->GetAverageNetUtilization(), data->GetNetworkFragmentationRatio()};
+    
+    //The replications are added in their order and only until the point
+    //converges, so the results do not depend on the order they finish.
+    while(!pending.empty() && pending.begin()->first == 
+    values.at(ReplicReqBP).size() && !this->IsReplicConverged(precision)){
+        
+        for(unsigned int a = FirstReplicMetric; a <= LastReplicMetric; a++)
+            values.at(a).push_back(pending.begin()->second.at(a));
+        pending.erase(pending.begin());
+    }
 }
 
 void Data::StorageCall(Call* call) {
+    PROFILE_SCOPE(PhaseStorageCall);
     double bitRate = call->GetBitRate();
     unsigned int numSlot = call->GetNumberSlots();
     
@@ -161,12 +261,13 @@ void Data::SaveLog() {
                                      ->GetLogFile();
     unsigned int numLoadPoints = this->simulType->GetParameters()
                                      ->GetNumberLoadPoints();
-    logOfstream << "DATA" << std::endl;
+    logOfstream << "DATA" << '\n';
     
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
-        logOfstream << this << std::endl;
+        logOfstream << this << '\n';
     }
+    logOfstream.flush();
 }
 
 void Data::SaveLog(std::vector<unsigned> vecParam) {
@@ -174,13 +275,14 @@ void Data::SaveLog(std::vector<unsigned> vecParam) {
                                      ->GetLogFile();
     unsigned int numPoints = vecParam.size();
     
-    logOfstream << "DATA" << std::endl;
+    logOfstream << "DATA" << '\n';
     
     for(unsigned int a = 0; a < numPoints; a++){
         this->SetActualIndex(a);
-        logOfstream << "Number of devices: " << vecParam.at(a) << std::endl;
-        logOfstream << this << std::endl;
+        logOfstream << "Number of devices: " << vecParam.at(a) << '\n';
+        logOfstream << this << '\n';
     }
+    logOfstream.flush();
 }
 
 void Data::SaveBP() {
@@ -190,7 +292,9 @@ void Data::SaveBP() {
                                           ->GetBandBpFile();
     
     this->SaveCallReqBP(callReqBP);
+    callReqBP.flush();
     this->SaveBandwidthBP(bandwidthBP);
+    bandwidthBP.flush();
 }
 
 void Data::SaveNetUtiliz() {
@@ -198,6 +302,7 @@ void Data::SaveNetUtiliz() {
                                      ->GetNetUtilizFile();
     
     this->SaveNetUtiliz(netUtiliz);
+    netUtiliz.flush();
 }
 
 void Data::SaveNetFrag() {
@@ -205,6 +310,7 @@ void Data::SaveNetFrag() {
                                      ->GetNetFragFile();
     
     this->SaveNetFrag(netFrag);
+    netFrag.flush();
 }
 
 void Data::SaveAccumNetFrag() {
@@ -212,18 +318,21 @@ void Data::SaveAccumNetFrag() {
                                      ->GetAccumNetFragFile();
     
     this->SaveAccumNetFrag(accumNetFrag);
+    accumNetFrag.flush();
 }
 
 void Data::SaveFragTraffic() {
     std::ofstream &netFrag = this->simulType->GetInputOutput()
                                  ->GetFragBandFile();
     this->SaveBandFrag(netFrag);
+    netFrag.flush();
 }
 
 void Data::SaveLinksUse() {
     std::ofstream &linksUse = this->simulType->GetInputOutput()->GetLinksUse();
     
     this->SaveLinksUse(linksUse);
+    linksUse.flush();
 }
 
 void Data::SaveSlotsRelativeUse() {
@@ -231,39 +340,121 @@ void Data::SaveSlotsRelativeUse() {
             GetSlotsRelativeUse();
     
     this->SaveSlotsRelativeUse(slotsRelativeUse);
+    slotsRelativeUse.flush();
 }
 
 void Data::SaveNetProtRate() {
     std::ofstream &netProtRate = this->simulType->GetInputOutput()->GetNetProtRate();
     
     this->SaveNetProtRate(netProtRate);
+    netProtRate.flush();
 }
 
 void Data::SaveNetNonProtRate() {
     std::ofstream &netNonProtRate = this->simulType->GetInputOutput()->GetNetNonProtRate();
     
     this->SaveNetNonProtRate(netNonProtRate);
+    netNonProtRate.flush();
 }
 
 void Data::SaveNetBetaAverage() {
     std::ofstream &netBetaAverage = this->simulType->GetInputOutput()->GetNetBetaAverage();
     
     this->SaveNetBetaAverage(netBetaAverage);
+    netBetaAverage.flush();
 }
 
 void Data::SaveNetAlphaAverage() {
     std::ofstream &netAlphaAverage = this->simulType->GetInputOutput()->GetNetAlphaAverage();
 
     this->SaveNetAlphaAverage(netAlphaAverage);
+    netAlphaAverage.flush();
 }
 
 void Data::SaveNumHopsRoutes() {
     std::ofstream &numHopsRoutes = this->simulType->GetInputOutput()->GetNumHopsRoutes();
-    if(this->simulType->GetOptions()->GetRoutingOption() == RoutingYEN)
+    if(this->simulType->GetOptions()->GetRoutingOption() == RoutingYEN){
         this->SaveNumHopsRoutes(numHopsRoutes);
+        numHopsRoutes.flush();
+    }
 }
 
 
+void Data::SaveResults() {
+    ResultOption resultOption = this->simulType->GetOptions()
+                                    ->GetResultOption();
+    InputOutput* inputOutput = this->simulType->GetInputOutput();
+    Parameters* parameters = this->simulType->GetParameters();
+    unsigned int numLoadPoints = parameters->GetNumberLoadPoints();
+    unsigned int numSlots = parameters->GetNumberSlots();
+    ResultTable points("Points", {{"LoadPoint", ResultDouble}, 
+    {"Replications", ResultUnsigned}, {"Requests", ResultUnsigned}, 
+    {"BlockedRequests", ResultUnsigned}, {"AcceptedRequests", ResultUnsigned},
+    {"ReqBP", ResultDouble}, {"ReqBPCI", ResultDouble}, 
+    {"SlotsBP", ResultDouble}, {"SlotsBPCI", ResultDouble}, 
+    {"NetUtilization", ResultDouble}, {"NetFragmentation", ResultDouble}, 
+    {"AverageHops", ResultDouble}, {"ProtRate", ResultDouble}, 
+    {"NonProtRate", ResultDouble}, {"BetaAverage", ResultDouble}, 
+    {"AlphaAverage", ResultDouble}, {"SimulTime", ResultDouble}, 
+    {"RealSimulTime", ResultDouble}});
+    ResultTable links("LinksUse", {{"LoadPoint", ResultDouble}, 
+    {"OrNode", ResultUnsigned}, {"DeNode", ResultUnsigned}, 
+    {"Use", ResultUnsigned}});
+    ResultTable slots("SlotsUse", {{"LoadPoint", ResultDouble}, 
+    {"Slot", ResultUnsigned}, {"RelativeUse", ResultDouble}});
+    ResultTable frag("NetFragSamples", {{"LoadPoint", ResultDouble}, 
+    {"Sample", ResultUnsigned}, {"NetFragmentation", ResultDouble}});
+    ResultWriter writer;
+    double load;
+    bool replic;
+    
+    if(resultOption == ResultText)
+        return;
+    
+    for(unsigned int a = 0; a < numLoadPoints; a++){
+        this->SetActualIndex(a);
+        load = parameters->GetLoadPoint(a);
+        replic = this->GetNumReplications() > 1;
+        
+        points.AddRow({load, (double) std::max(this->GetNumReplications(), 
+        1U), this->GetNumberReq(), this->GetNumberBlocReq(), 
+        this->GetNumberAccReq(), 
+        replic ? this->GetReplicMean(ReplicReqBP) : this->GetReqBP(), 
+        replic ? this->GetReplicConfInterval(ReplicReqBP) : 0.0, 
+        replic ? this->GetReplicMean(ReplicSlotsBP) : this->GetSlotsBP(), 
+        replic ? this->GetReplicConfInterval(ReplicSlotsBP) : 0.0, 
+        replic ? this->GetReplicMean(ReplicNetUtiliz) : 
+        this->GetAverageNetUtilization(), 
+        replic ? this->GetReplicMean(ReplicNetFrag) : 
+        this->GetNetworkFragmentationRatio(), this->GetAverageNumHops(), 
+        this->GetProtRate(), this->GetNonProtRate(), 
+        this->GetNetBetaAverage(), this->GetNetAlphaAverage(), 
+        this->GetSimulTime(), this->GetRealSimulTime()});
+        
+        for(auto const& pair: linksUse.at(a))
+            links.AddRow({load, (double) pair.first.first, 
+                         (double) pair.first.second, (double) pair.second});
+        
+        for(unsigned int b = 0; b < numSlots; b++)
+            slots.AddRow({load, (double) b, slotsRelativeUse.at(a).at(b) / 
+                         numberAccSlotsInt.at(a)});
+        
+        for(unsigned int b = 0; b < accumNetFragmentationRatio.at(a).size(); 
+        b++)
+            frag.AddRow({load, (double) b, 
+                        accumNetFragmentationRatio.at(a).at(b)});
+    }
+    
+    writer.AddTable(points);
+    writer.AddTable(links);
+    writer.AddTable(slots);
+    writer.AddTable(frag);
+    writer.WriteCsv(inputOutput->GetResultsName(".csv"));
+    
+    if(resultOption == ResultCsvBinary)
+        writer.WriteBinary(inputOutput->GetResultsName(".bin"));
+}
+
 void Data::SaveBP(std::vector<unsigned> vecParam) {
     std::ofstream &callReqBP = this->simulType->GetInputOutput()
                                         ->GetReqBpFile();
@@ -271,7 +462,9 @@ void Data::SaveBP(std::vector<unsigned> vecParam) {
                                           ->GetBandBpFile();
     
     this->SaveCallReqBP(callReqBP, vecParam);
+    callReqBP.flush();
     this->SaveBandwidthBP(bandwidthBP, vecParam);
+    bandwidthBP.flush();
 }
 
 void Data::SaveGaFiles() {
@@ -424,6 +617,15 @@ void Data::SetLinksUse(Topology* topology) {
 }
 
 void Data::SetSlotsRelativeUse(Call* call) {
+    CallDevices* callDev = dynamic_cast<CallDevices*>(call);
+    
+    //A regenerated call occupies the slots of its transparent segments.
+    if(callDev && !callDev->GetTranspSegments().empty()){
+        
+        for(auto it: callDev->GetTranspSegments())
+            this->SetSlotsRelativeUse(it);
+        return;
+    }
     unsigned int callFirstSlot = call->GetFirstSlot();
     unsigned int callLastSlot = call->GetLastSlot();
     
@@ -496,6 +698,79 @@ double Data::GetNetAlphaAverage() const {
     return this->GetSumCallsAlpha() / this->GetProtectedCalls();
 }
 
+unsigned int Data::GetNumReplications() const {
+    
+    if(actualIndex >= replicValues.size())
+        return 0;
+    
+    return replicValues.at(actualIndex).at(ReplicReqBP).size();
+}
+
+double Data::GetReplicMean(ReplicationMetric metric) const {
+    const std::vector<double>& values = replicValues.at(actualIndex).
+                                        at(metric);
+    assert(!values.empty());
+    
+    return std::accumulate(values.begin(), values.end(), 0.0) / 
+           values.size();
+}
+
+double Data::GetReplicVariance(ReplicationMetric metric) const {
+    const std::vector<double>& values = replicValues.at(actualIndex).
+                                        at(metric);
+    double mean = this->GetReplicMean(metric);
+    double sum = 0.0;
+    
+    if(values.size() < 2)
+        return 0.0;
+    
+    for(auto it: values)
+        sum += (it - mean) * (it - mean);
+    
+    return sum / (values.size() - 1);
+}
+
+double Data::GetReplicConfInterval(ReplicationMetric metric) const {
+    unsigned int numReplications = this->GetNumReplications();
+    
+    if(numReplications < 2)
+        return Def::Max_Double;
+    
+    return Data::GetStudentQuantile(numReplications) * 
+           std::sqrt(this->GetReplicVariance(metric) / numReplications);
+}
+
+bool Data::IsReplicConverged(double precision) const {
+    
+    if(precision <= 0.0 || this->GetNumReplications() < 2)
+        return false;
+    
+    return this->GetReplicConfInterval(ReplicReqBP) <= 
+           precision * this->GetReplicMean(ReplicReqBP);
+}
+
+double Data::GetStudentQuantile(unsigned int numSamples) {
+    //Two-sided 95% quantiles of the Student's t distribution, by degrees
+    //of freedom. The normal quantile is used above the table.
+    static const std::vector<double> tQuantiles = {12.706, 4.303, 3.182, 
+    2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228, 2.201, 2.179, 2.160, 
+    2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 
+    2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042};
+    assert(numSamples >= 2);
+    
+    if(numSamples - 1 <= tQuantiles.size())
+        return tQuantiles.at(numSamples - 2);
+    
+    return 1.96;
+}
+
+void Data::SaveReplications(std::ostream& ostream, ReplicationMetric metric) {
+    ostream << this->GetReplicMean(metric) << "\t" 
+            << this->GetReplicVariance(metric) << "\t" 
+            << this->GetReplicConfInterval(metric) << "\t" 
+            << this->GetNumReplications();
+}
+
 void Data::SaveCallReqBP(std::ostream& ostream) {
     unsigned int numLoadPoints = this->simulType->GetParameters()
                                      ->GetNumberLoadPoints();
@@ -503,8 +778,13 @@ void Data::SaveCallReqBP(std::ostream& ostream) {
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
-                   this->GetActualIndex()) << "\t" << this->GetReqBP() 
-                << std::endl;
+                   this->GetActualIndex()) << "\t";
+        
+        if(this->GetNumReplications() > 1)
+            this->SaveReplications(ostream, ReplicReqBP);
+        else
+            ostream << this->GetReqBP();
+        ostream << '\n';
     }
 }
 
@@ -515,8 +795,13 @@ void Data::SaveBandwidthBP(std::ostream& ostream) {
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
-                   this->GetActualIndex()) << "\t" << this->GetSlotsBP() 
-                << std::endl;
+                   this->GetActualIndex()) << "\t";
+        
+        if(this->GetNumReplications() > 1)
+            this->SaveReplications(ostream, ReplicSlotsBP);
+        else
+            ostream << this->GetSlotsBP();
+        ostream << '\n';
     }
 }
 
@@ -525,7 +810,7 @@ void Data::SaveCallReqBP(std::ostream& ostream, std::vector<unsigned> vec) {
     
     for(unsigned int a = 0; a < vec.size(); a++){
         this->SetActualIndex(a);
-        ostream << vec.at(a) << "\t" << this->GetReqBP() << std::endl;
+        ostream << vec.at(a) << "\t" << this->GetReqBP() << '\n';
     }
 }
 
@@ -534,7 +819,7 @@ void Data::SaveBandwidthBP(std::ostream& ostream, std::vector<unsigned> vec) {
     
     for(unsigned int a = 0; a < vec.size(); a++){
         this->SetActualIndex(a);
-        ostream << vec.at(a) << "\t" << this->GetSlotsBP() << std::endl;
+        ostream << vec.at(a) << "\t" << this->GetSlotsBP() << '\n';
     }
 }
 
@@ -545,8 +830,13 @@ void Data::SaveNetUtiliz(std::ostream& ostream) {
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
-                   this->GetActualIndex()) << "\t" 
-                << this->GetAverageNetUtilization() << std::endl;
+                   this->GetActualIndex()) << "\t";
+        
+        if(this->GetNumReplications() > 1)
+            this->SaveReplications(ostream, ReplicNetUtiliz);
+        else
+            ostream << this->GetAverageNetUtilization();
+        ostream << '\n';
     }
 }
 
@@ -557,8 +847,13 @@ void Data::SaveNetFrag(std::ostream& ostream) {
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
-                   this->GetActualIndex()) << "\t" 
-                << this->GetNetworkFragmentationRatio() << std::endl;
+                   this->GetActualIndex()) << "\t";
+        
+        if(this->GetNumReplications() > 1)
+            this->SaveReplications(ostream, ReplicNetFrag);
+        else
+            ostream << this->GetNetworkFragmentationRatio();
+        ostream << '\n';
     }
 }
 
@@ -572,46 +867,42 @@ unsigned int numLoadPoints = this->simulType->GetParameters()
         for(unsigned int b = 0; b < accumNetFragmentationRatio.at(actualIndex).
         size(); b++){
             ostream << b << "\t" << accumNetFragmentationRatio.at(actualIndex).at(b) 
-            << std::endl;
+            << '\n';
         }  
-        ostream << std::endl;    
+        ostream << '\n';    
     }        
 }
 
 void Data::SaveBandFrag(std::ostream& ostream) {
     unsigned int numLoadPoints = this->simulType->GetParameters()
                                      ->GetNumberLoadPoints();
-    std::vector<std::pair<double, double>> bandFrag;
     
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
-        bandFrag = fragPerTraffic.at(actualIndex);
         
-        for(auto const& pair: bandFrag){
-            ostream << pair.first << "\t" << pair.second << std::endl;
+        for(auto const& pair: fragPerTraffic.at(actualIndex)){
+            ostream << pair.first << "\t" << pair.second << '\n';
         }
-        ostream << std::endl;
+        ostream << '\n';
     }
 }
 
 void Data::SaveLinksUse(std::ostream& ostream) {
     unsigned int numLoadPoints = this->simulType->GetParameters()
                                      ->GetNumberLoadPoints();
-    std::map<std::pair<unsigned, unsigned>, unsigned> auxMap;
     std::pair<unsigned, unsigned> nodePair;
     unsigned int use;
     
     for(unsigned int a = 0; a < numLoadPoints; a++){
         this->SetActualIndex(a);
-        auxMap = linksUse.at(actualIndex);
         
-        for(auto const& pair: auxMap){
+        for(auto const& pair: linksUse.at(actualIndex)){
             nodePair = pair.first;
             use = pair.second;
             ostream << nodePair.first << "->" << nodePair.second << "\t"
-                    << use << std::endl;
+                    << use << '\n';
         }
-        ostream << std::endl;
+        ostream << '\n';
     }
 }
 
@@ -624,12 +915,10 @@ void Data::SaveSlotsRelativeUse(std::ostream& ostream) {
         this->SetActualIndex(a);
             
         for(unsigned int b = 0; b < numSlots; b++){
-            slotsRelativeUse.at(actualIndex).at(b) = 
-            slotsRelativeUse.at(actualIndex).at(b) / numberAccSlotsInt.at(actualIndex);
-            ostream << b << "\t" << slotsRelativeUse.at(actualIndex).at(b) 
-            << std::endl;
+            ostream << b << "\t" << slotsRelativeUse.at(actualIndex).at(b) / 
+            numberAccSlotsInt.at(actualIndex) << '\n';
         }  
-        ostream << std::endl;    
+        ostream << '\n';    
     }        
 }
 
@@ -641,7 +930,7 @@ void Data::SaveNetProtRate(std::ostream& ostream) {
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
                    this->GetActualIndex()) << "\t" << this->GetProtRate() 
-                << std::endl;
+                << '\n';
     }
 }
 
@@ -653,7 +942,7 @@ void Data::SaveNetNonProtRate(std::ostream& ostream) {
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
                    this->GetActualIndex()) << "\t" << this->GetNonProtRate() 
-                << std::endl;
+                << '\n';
     }
 }
 
@@ -665,7 +954,7 @@ void Data::SaveNetBetaAverage(std::ostream& ostream) {
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
                    this->GetActualIndex()) << "\t" << this->GetNetBetaAverage() 
-                << std::endl;
+                << '\n';
     }
 }
 
@@ -677,14 +966,14 @@ void Data::SaveNetAlphaAverage(std::ostream &ostream) {
         this->SetActualIndex(a);
         ostream << this->simulType->GetParameters()->GetLoadPoint(
                 this->GetActualIndex()) << "\t" << this->GetNetAlphaAverage()
-                << std::endl;
+                << '\n';
     }
 }
 
 void Data::SaveNumHopsRoutes(std::ostream &ostream) {
-    std::vector<std::vector<std::shared_ptr<Route>>> auxAllRoutes = this->simulType->
-            GetResourceAlloc()->resources->allRoutes;
-    std::vector<std::vector<std::vector<std::shared_ptr<Route>>>>
+    const std::vector<std::vector<std::shared_ptr<Route>>>& auxAllRoutes = 
+            this->simulType->GetResourceAlloc()->resources->allRoutes;
+    const std::vector<std::vector<std::vector<std::shared_ptr<Route>>>>&
             auxProtectionAllRoutes = this->simulType->GetResourceAlloc()->
             resources->protectionAllRoutes;
     unsigned int numNodes = this->simulType->GetTopology()->GetNumNodes();
@@ -697,8 +986,11 @@ void Data::SaveNumHopsRoutes(std::ostream &ostream) {
                     ostream << path.at(a) <<"-";
                 }
                 ostream << "\t" << auxAllRoutes.at(orN*numNodes+deN).front().get()->GetNumHops()
-                << std::endl;
-                unsigned int numDisjRoutes = auxProtectionAllRoutes.at(orN*numNodes+deN).front().size();
+                << '\n';
+                unsigned int numDisjRoutes = 0;
+                //The protection routes are only created with protection.
+                if(!auxProtectionAllRoutes.empty() && !auxProtectionAllRoutes.at(orN*numNodes+deN).empty())
+                    numDisjRoutes = auxProtectionAllRoutes.at(orN*numNodes+deN).front().size();
                 for(unsigned int kd = 0; kd < numDisjRoutes; kd++) {
                     if(auxProtectionAllRoutes.at(orN * numNodes + deN).front().at(kd) == nullptr)
                         continue;
@@ -708,10 +1000,10 @@ void Data::SaveNumHopsRoutes(std::ostream &ostream) {
                         ostream << path.at(a) <<"-";
                     }
                     ostream << "\t" << auxProtectionAllRoutes.at(orN * numNodes + deN)
-                    .front().at(kd).get()->GetNumHops()  << std::endl;
+                    .front().at(kd).get()->GetNumHops()  << '\n';
                 }
             }
-            ostream << std::endl;
+            ostream << '\n';
         }
     }
 }
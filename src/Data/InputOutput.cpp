@@ -11,10 +11,16 @@
  * Created on August 8, 2018, 8:14 PM
  */
 
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
 #include "../../include/Data/InputOutput.h"
 #include "../../include/SimulationType/SimulationType.h"
 #include "../../include/Data/Options.h"
 
+bool InputOutput::interactive = true;
+
 InputOutput::InputOutput(SimulationType* simulType)
 :simulType(simulType) {
     this->LoadLog(logFile);
@@ -50,10 +56,8 @@ void InputOutput::LoadParameters(std::ifstream& parameters) {
             std::cerr << "Wrong parameter file." << std::endl;
             std::cerr << "The file required is: Parameters_" 
                       << auxInt << ".txt" << std::endl;
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!parameters.is_open());
@@ -69,11 +73,9 @@ void InputOutput::LoadOptions(std::ifstream& options) {
         if(!options.is_open()) {       
             std::cerr << "Wrong options file." << std::endl;
             std::cerr << "The file required is: Options_" 
-                      << auxInt << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << auxInt << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!options.is_open());
@@ -90,11 +92,9 @@ void InputOutput::LoadTopology(std::ifstream& topology) {
         if(!topology.is_open()) {       
             std::cerr << "Wrong topology file." << std::endl;
             std::cerr << "The file required is: " 
-                      << topologyName << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << topologyName << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!topology.is_open());
 }
@@ -111,14 +111,31 @@ void InputOutput::LoadTraffic(std::ifstream& traffic) {
             std::cerr << "Wrong traffic file." << std::endl;
             std::cerr << "The file required is: Traffic_" 
                       << trafficName << ".txt" << std::endl;
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!traffic.is_open());
 }
 
+void InputOutput::LoadTrafficMatrix(std::ifstream& matrix, bool binary) {
+    std::string matrixName = this->GetTrafficMatrixName(binary);
+    
+    do{
+        if(binary)
+            matrix.open(matrixName, std::ios::binary);
+        else
+            matrix.open(matrixName);
+        
+        if(!matrix.is_open()) {
+            std::cerr << "Wrong traffic matrix file." << std::endl;
+            std::cerr << "The file required is: " << matrixName 
+                      << std::endl;
+            
+            this->WaitFileFix("file");
+        }
+    }while(!matrix.is_open());
+}
+
 void InputOutput::LoadGA(std::ifstream& gaParam) {
     const SimulIndex auxInt = this->simulType->GetSimulationIndex();
     
@@ -129,11 +146,9 @@ void InputOutput::LoadGA(std::ifstream& gaParam) {
         if(!gaParam.is_open()) {       
             std::cerr << "Wrong options file." << std::endl;
             std::cerr << "The file required is: GA_" 
-                      << auxInt << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << auxInt << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!gaParam.is_open());
@@ -149,11 +164,9 @@ void InputOutput::LoadGA_SO(std::ifstream& gaSoParam) {
         if(!gaSoParam.is_open()) {       
             std::cerr << "Wrong options file." << std::endl;
             std::cerr << "The file required is: GA_SO_" 
-                      << auxInt << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << auxInt << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!gaSoParam.is_open());
@@ -169,11 +182,9 @@ void InputOutput::LoadGA_MO(std::ifstream& gaMoParam) {
         if(!gaMoParam.is_open()) {       
             std::cerr << "Wrong options file." << std::endl;
             std::cerr << "The file required is: GA_MO_" 
-                      << auxInt << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << auxInt << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!gaMoParam.is_open());
@@ -189,10 +200,8 @@ void InputOutput::LoadRsaOrderFirstSimul(std::ifstream& orderRsa) {
             std::cerr << "Wrong RSA order file." << std::endl;
             std::cerr << "The file required is: Files/Outputs/"
             "1/GA/BestIndividual.txt" << std::endl;
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!orderRsa.is_open());
 }
@@ -207,10 +216,8 @@ void InputOutput::LoadPDPPBitRateNodePairsDistFirstSimul(std::ifstream& bitRateD
             std::cerr << "Wrong Bit Rate Distribuition file." << std::endl;
             std::cerr << "The file required is: Files/Outputs/"
                          "1/GA/BestIndividual.txt" << std::endl;
-            std::cerr << "Add/Fix the file then press 'Enter'"
-                      << std::endl;
 
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!bitRateDist.is_open());
 }
@@ -225,11 +232,9 @@ void InputOutput::LoadDevicesFile(std::ifstream& devicesFile) {
         if(!devicesFile.is_open()) {
             std::cerr << "Wrong options file." << std::endl;
             std::cerr << "The file required is: Devices" 
-                      << auxInt << ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
+                      << auxInt << ".txt" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
 
     }while(!devicesFile.is_open());
@@ -244,10 +249,10 @@ void InputOutput::LoadPSO(std::ifstream& psoFile) {
         
         if(!psoFile.is_open()){
             std::cerr << "Wrong PSO file." << std::endl;
-            std::cerr << "The file required is: PSO_" + auxString + ".txt";
-            std::cerr << "Add/Fix the file then press 'Enter'" << std::endl;
+            std::cerr << "The file required is: PSO_" + auxString + ".txt" 
+                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!psoFile.is_open());
 }
@@ -261,14 +266,77 @@ void InputOutput::LoadCoefficientsSCRA(std::ifstream& coeSCRA) {
             std::cerr << "Wrong PSO coefficients file." << std::endl;
             std::cerr << "The file required is: Files/Outputs/"
             "1/PSO/BestParticle.txt" << std::endl;
-            std::cerr << "Add/Fix the file then press 'Enter'" 
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("file");
         }
     }while(!coeSCRA.is_open());
 }
 
+bool InputOutput::CheckInputFiles() const {
+    const std::string auxString = std::to_string(this->simulType->
+                                                 GetSimulationIndex());
+    Options* options = this->simulType->GetOptions();
+    std::vector<std::string> fileNames = {
+        "Files/Inputs/Topologies/" + options->GetTopologyName() + ".txt",
+        "Files/Inputs/Traffics/Traffic_" + options->GetTrafficName() + ".txt"
+    };
+    bool filesFound = true;
+    
+    if(options->GetTrafficMatrixOption() != TrafficMatrixUniform)
+        fileNames.push_back(this->GetTrafficMatrixName(
+        options->GetTrafficMatrixOption() == TrafficMatrixBinary));
+    if(options->GetDevicesOption() != DevicesDisabled)
+        fileNames.push_back("Files/Inputs/Devices/Devices_" + auxString + 
+                            ".txt");
+    
+    switch(this->simulType->GetTypeSimulation()){
+        case GaSimulationType:
+            fileNames.push_back("Files/Inputs/GA/GA_" + auxString + ".txt");
+            fileNames.push_back("Files/Inputs/GA/GA_SO_" + auxString + 
+                                ".txt");
+            break;
+        case PsoSimulationType:
+            fileNames.push_back("Files/Inputs/PSO/PSO_" + auxString + ".txt");
+            break;
+        default:
+            break;
+    }
+    
+    for(auto& it: fileNames){
+        std::ifstream auxFile(it);
+        
+        if(!auxFile.is_open()){
+            std::cerr << "Missing file of simulation " << auxString << ": " 
+                      << it << std::endl;
+            filesFound = false;
+        }
+    }
+    
+    return filesFound;
+}
+
+std::string InputOutput::GetResourcesCacheName(const std::string& key) 
+const {
+    return "Files/Cache/Resources_" + key + ".bin";
+}
+
+std::string InputOutput::GetTraceName(unsigned int loadPoint, 
+unsigned int replication) const {
+    return "Files/Traces/Trace_" + std::to_string(loadPoint) + "_" + 
+           std::to_string(replication) + ".bin";
+}
+
+std::string InputOutput::GetTrafficMatrixName(bool binary) const {
+    return "Files/Inputs/Traffics/Matrix_" + 
+           this->simulType->GetOptions()->GetTopologyName() + 
+           (binary ? ".bin" : ".txt");
+}
+
+std::string InputOutput::GetResultsName(const std::string& suffix) const {
+    return "Files/Outputs/" + std::to_string(this->simulType->
+           GetSimulationIndex()) + "/Results" + suffix;
+}
+
 void InputOutput::LoadReqBP(std::ofstream& pBvLoad) {
     const SimulIndex auxInt = this->simulType->GetSimulationIndex();
     
@@ -280,10 +348,8 @@ void InputOutput::LoadReqBP(std::ofstream& pBvLoad) {
             std::cerr << "Wrong result file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!pBvLoad.is_open());
 }
@@ -299,10 +365,8 @@ void InputOutput::LoadBandBP(std::ofstream& bandBP) {
             std::cerr << "Wrong result file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!bandBP.is_open());
 }
@@ -318,10 +382,8 @@ void InputOutput::LoadNetUtiliz(std::ofstream& netUtiliz) {
             std::cerr << "Wrong result file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netUtiliz.is_open());
 }
@@ -337,10 +399,8 @@ void InputOutput::LoadNetFrag(std::ofstream& netFrag) {
             std::cerr << "Wrong result file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netFrag.is_open());
 }
@@ -356,10 +416,8 @@ void InputOutput::LoadAccumNetFrag(std::ofstream& accumNetFrag) {
             std::cerr << "Wrong result file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!accumNetFrag.is_open());
 }
@@ -375,10 +433,8 @@ void InputOutput::LoadFragBand(std::ofstream& fragBand) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!fragBand.is_open());
 }
@@ -394,10 +450,8 @@ void InputOutput::LoadLog(std::ofstream& log) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!log.is_open());
 }
@@ -413,10 +467,8 @@ void InputOutput::LoadLinksUse(std::ofstream& linksUse) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!linksUse.is_open());
 }
@@ -432,10 +484,8 @@ void InputOutput::LoadSlotsRelativeUse(std::ofstream& slotsRelativeUse) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!slotsRelativeUse.is_open());
 }
@@ -451,10 +501,8 @@ void InputOutput::LoadNetProtRate(std::ofstream& netProtRate) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netProtRate.is_open());
 }
@@ -470,10 +518,8 @@ void InputOutput::LoadNetNonProtRate(std::ofstream& netNonProtRate) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netNonProtRate.is_open());
 }
@@ -489,10 +535,8 @@ void InputOutput::LoadNetBetaAverage(std::ofstream& netBetaAverage) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netBetaAverage.is_open());
 }
@@ -508,10 +552,8 @@ void InputOutput::LoadNetAlphaAverage(std::ofstream &netAlphaAverage) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
 
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!netAlphaAverage.is_open());
 }
@@ -527,10 +569,8 @@ void InputOutput::LoadNumHopsRoutes(std::ofstream &numHopsRoutes) {
             std::cerr << "Wrong log file." << std::endl;
             std::cerr << "The folder required is: " << auxInt
                       << "/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
 
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!numHopsRoutes.is_open());
 }
@@ -548,10 +588,8 @@ std::ofstream& worst, std::ofstream& iniPop) {
             std::cerr << "Wrong best individuals file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/GA/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!bests.is_open());
     
@@ -563,10 +601,8 @@ std::ofstream& worst, std::ofstream& iniPop) {
             std::cerr << "Wrong best individuals file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/GA/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!best.is_open());
     
@@ -578,10 +614,8 @@ std::ofstream& worst, std::ofstream& iniPop) {
             std::cerr << "Wrong worst individuals file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/GA/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!worst.is_open());
     
@@ -593,10 +627,8 @@ std::ofstream& worst, std::ofstream& iniPop) {
             std::cerr << "Wrong initial population file." << std::endl;
             std::cerr << "The folder required is: " << auxInt 
                       << "/GA/" << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'"
-                      << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!iniPop.is_open());
 }
@@ -612,9 +644,8 @@ void InputOutput::LoadPsoFiles(std::ofstream& best, std::ofstream& bests) {
             std::cerr << "Wrong best particle file." << std::endl;
             std::cerr << "The folder required is: " << string << "/PSO/" 
                       << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!best.is_open());
     
@@ -625,9 +656,8 @@ void InputOutput::LoadPsoFiles(std::ofstream& best, std::ofstream& bests) {
             std::cerr << "Wrong best particles file." << std::endl;
             std::cerr << "The folder required is: " << string << "/PSO/" 
                       << std::endl;
-            std::cerr << "Add/Fix the folder, then press 'Enter'" << std::endl;
             
-            std::cin.get();
+            this->WaitFileFix("folder");
         }
     }while(!bests.is_open());
 }
@@ -760,10 +790,24 @@ void InputOutput::PrintProgressBar(unsigned actual, unsigned min, unsigned max)
     std::cout.flush();
 }
 
+void InputOutput::SetInteractive(bool interactive) {
+    InputOutput::interactive = interactive;
+}
 
+bool InputOutput::IsInteractive() {
+    return InputOutput::interactive;
+}
 
-
-
-
-
-
+void InputOutput::WaitFileFix(const std::string& missing) const {
+    
+    if(!InputOutput::interactive){
+        std::cerr << "Missing file in non-interactive mode, simulation " 
+                  << this->simulType->GetSimulationIndex() << " aborted" 
+                  << std::endl;
+        std::exit(ExitMissingFile);
+    }
+    
+    std::cerr << "Add/Fix the " << missing << ", then press 'Enter'" 
+              << std::endl;
+    std::cin.get();
+}
@@ -145,7 +145,8 @@ Options::mapRegAssOption = boost::assign::map_list_of
 const boost::unordered_map<StopCriteria, std::string>
 Options::mapStopCriteria = boost::assign::map_list_of
     (NumCallRequestsMaximum, "Number of call requests")
-    (NumCallRequestsBlocked, "Number of blocked call requests");
+    (NumCallRequestsBlocked, "Number of blocked call requests")
+    (BlockingConverged, "Convergence of the call request blocking");
 
 const boost::unordered_map<RandomGenerationOption, std::string>
 Options::mapRandomGeneration = boost::assign::map_list_of
@@ -169,6 +170,40 @@ Options::mapFragMeasureOption = boost::assign::map_list_of
     (FragMetricEF, "External Fragmentation (EF)")
     (FragMetricABP, "Access Blocking Probability (ABP)");
 
+const boost::unordered_map<ExecutionOption, std::string>
+Options::mapExecutionOption = boost::assign::map_list_of
+    (ExecutionSequential, "Sequential")
+    (ExecutionParallel, "Parallel");
+
+const boost::unordered_map<CacheOption, std::string>
+Options::mapCacheOption = boost::assign::map_list_of
+    (CacheDisabled, "Disabled")
+    (CacheEnabled, "Enabled");
+
+const boost::unordered_map<TraceOption, std::string>
+Options::mapTraceOption = boost::assign::map_list_of
+    (TraceDisabled, "Disabled")
+    (TraceRecord, "Record")
+    (TraceReplay, "Replay");
+
+const boost::unordered_map<TransientOption, std::string>
+Options::mapTransientOption = boost::assign::map_list_of
+    (TransientDisabled, "Disabled")
+    (TransientFixed, "Fixed number of requests")
+    (TransientMSER, "MSER detection");
+
+const boost::unordered_map<ResultOption, std::string>
+Options::mapResultOption = boost::assign::map_list_of
+    (ResultText, "Text files")
+    (ResultCsv, "Text and CSV files")
+    (ResultCsvBinary, "Text, CSV and binary files");
+
+const boost::unordered_map<TrafficMatrixOption, std::string>
+Options::mapTrafficMatrixOption = boost::assign::map_list_of
+    (TrafficMatrixUniform, "Uniform")
+    (TrafficMatrixText, "Text file")
+    (TrafficMatrixBinary, "Binary file");
+
 std::ostream& operator<<(std::ostream& ostream,
 const Options* options) {
     ostream << "OPTIONS" << std::endl;
@@ -213,6 +248,18 @@ const Options* options) {
             << std::endl;
     ostream << "Fragmentation Option: " << options->GetFragMeasureOptionName()
             << std::endl;
+    ostream << "Load points execution: " << options->GetExecutionOptionName()
+            << std::endl;
+    ostream << "Offline tables cache: " << options->GetCacheOptionName()
+            << std::endl;
+    ostream << "Request trace: " << options->GetTraceOptionName()
+            << std::endl;
+    ostream << "Transient removal: " << options->GetTransientOptionName()
+            << std::endl;
+    ostream << "Result files: " << options->GetResultOptionName()
+            << std::endl;
+    ostream << "Traffic matrix: " << options->GetTrafficMatrixOptionName()
+            << std::endl;
     return ostream;
 }
 
@@ -226,7 +273,10 @@ GaOption(GaOptionDisabled), devicesOption(DevicesDisabled),
 transponderOption(TransponderDisabled), regenerationOption(RegenerationDisabled), 
 regPlacOption(RegPlacInvalid), regAssOption(RegAssInvalid), 
 stopCriteria(NumCallRequestsMaximum), generationOption(GenerationSame),
-protectionOption(ProtectionDisable), fragMeasureOpion(FragMetricDisabled) {
+protectionOption(ProtectionDisable), fragMeasureOpion(FragMetricDisabled),
+executionOption(ExecutionSequential), cacheOption(CacheDisabled),
+traceOption(TraceDisabled), transientOption(TransientDisabled),
+resultOption(ResultText), trafficMatrixOption(TrafficMatrixUniform) {
     
 }
 
@@ -437,6 +487,18 @@ void Options::LoadFile() {
     this->SetProtectionOption((ProtectionOption) auxInt);
     auxIfstream >> auxInt;
     this->SetFragMeasureOption((FragMeasureOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetExecutionOption((ExecutionOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetCacheOption((CacheOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetTraceOption((TraceOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetTransientOption((TransientOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetResultOption((ResultOption) auxInt);
+    auxIfstream >> auxInt;
+    this->SetTrafficMatrixOption((TrafficMatrixOption) auxInt);
 }
 
 void Options::Save() {
@@ -728,3 +790,86 @@ std::string Options::GetFragMeasureOptionName() const {
 void Options::SetFragMeasureOption(FragMeasureOption fragMeasureOption) {
     fragMeasureOpion = fragMeasureOption;
 }
+
+ExecutionOption Options::GetExecutionOption() const {
+    return executionOption;
+}
+
+std::string Options::GetExecutionOptionName() const {
+    return mapExecutionOption.at(executionOption);
+}
+
+void Options::SetExecutionOption(ExecutionOption executionOption) {
+    assert(executionOption >= FirstExecutionOption && 
+           executionOption <= LastExecutionOption);
+    this->executionOption = executionOption;
+}
+
+CacheOption Options::GetCacheOption() const {
+    return cacheOption;
+}
+
+std::string Options::GetCacheOptionName() const {
+    return mapCacheOption.at(cacheOption);
+}
+
+void Options::SetCacheOption(CacheOption cacheOption) {
+    assert(cacheOption >= FirstCacheOption && cacheOption <= LastCacheOption);
+    this->cacheOption = cacheOption;
+}
+
+TraceOption Options::GetTraceOption() const {
+    return traceOption;
+}
+
+std::string Options::GetTraceOptionName() const {
+    return mapTraceOption.at(traceOption);
+}
+
+void Options::SetTraceOption(TraceOption traceOption) {
+    assert(traceOption >= FirstTraceOption && traceOption <= LastTraceOption);
+    this->traceOption = traceOption;
+}
+
+TransientOption Options::GetTransientOption() const {
+    return transientOption;
+}
+
+std::string Options::GetTransientOptionName() const {
+    return mapTransientOption.at(transientOption);
+}
+
+void Options::SetTransientOption(TransientOption transientOption) {
+    assert(transientOption >= FirstTransientOption && 
+           transientOption <= LastTransientOption);
+    this->transientOption = transientOption;
+}
+
+ResultOption Options::GetResultOption() const {
+    return resultOption;
+}
+
+std::string Options::GetResultOptionName() const {
+    return mapResultOption.at(resultOption);
+}
+
+void Options::SetResultOption(ResultOption resultOption) {
+    assert(resultOption >= FirstResultOption && 
+           resultOption <= LastResultOption);
+    this->resultOption = resultOption;
+}
+
+TrafficMatrixOption Options::GetTrafficMatrixOption() const {
+    return trafficMatrixOption;
+}
+
+std::string Options::GetTrafficMatrixOptionName() const {
+    return mapTrafficMatrixOption.at(trafficMatrixOption);
+}
+
+void Options::SetTrafficMatrixOption(
+TrafficMatrixOption trafficMatrixOption) {
+    assert(trafficMatrixOption >= FirstTrafficMatrixOption && 
+           trafficMatrixOption <= LastTrafficMatrixOption);
+    this->trafficMatrixOption = trafficMatrixOption;
+}
@@ -52,6 +52,18 @@ const Parameters* parameters) {
             << std::endl;
     ostream << "Number of MPR Groups: " << parameters->GetNumberMPRGroups()
             << std::endl;
+    ostream << "Number of replications: " 
+            << parameters->GetNumberReplications() << std::endl;
+    ostream << "Replications relative precision: " 
+            << parameters->GetReplicationsPrecision() << std::endl;
+    ostream << "Number of warm-up requests: " 
+            << parameters->GetNumberWarmUpReq() << std::endl;
+    ostream << "Number of transient requests: " 
+            << parameters->GetNumberTransientReq() << std::endl;
+    ostream << "Number of requests per batch: " 
+            << parameters->GetNumberBatchReq() << std::endl;
+    ostream << "Batches relative precision: " 
+            << parameters->GetBatchPrecision() << std::endl;
     
     return ostream;
 }
@@ -61,7 +73,9 @@ Parameters::Parameters(SimulationType* simulType)
 loadPasso(0.0), numberLoadPoints(0), numberReqMax(0.0), mu(0.0), 
 numberBloqMax(0), slotBandwidth(0.0), numberSlots(0), numberCores(0), 
 maxSectionLegnth(0.0), numberPolarizations(0), guardBand(0), beta(0), 
-   numberPDPPprotectionRoutes(2), numberMPRGroups(0) {
+   numberPDPPprotectionRoutes(2), numberMPRGroups(0), numberReplications(1),
+replicationsPrecision(0.0), numberWarmUpReq(0.0), numberTransientReq(0.0),
+numberBatchReq(1E3), batchPrecision(0.0) {
     
 }
 
@@ -119,6 +133,25 @@ void Parameters::Load() {
     std::cout << "Insert the value for number of MPR groups: ";
     std::cin >> auxUnsInt;
     this->SetNumberMPRGroups(auxUnsInt);
+    std::cout << "Insert the number of replications of each load point: ";
+    std::cin >> auxUnsInt;
+    this->SetNumberReplications(auxUnsInt);
+    std::cout << "Insert the replications relative precision (0 to disable):"
+              << " ";
+    std::cin >> auxDouble;
+    this->SetReplicationsPrecision(auxDouble);
+    std::cout << "Insert the number of warm-up requests (0 to disable): ";
+    std::cin >> auxDouble;
+    this->SetNumberWarmUpReq(auxDouble);
+    std::cout << "Insert the number of transient requests: ";
+    std::cin >> auxDouble;
+    this->SetNumberTransientReq(auxDouble);
+    std::cout << "Insert the number of requests per batch: ";
+    std::cin >> auxDouble;
+    this->SetNumberBatchReq(auxDouble);
+    std::cout << "Insert the batches relative precision (0 to disable): ";
+    std::cin >> auxDouble;
+    this->SetBatchPrecision(auxDouble);
 
     this->SetLoadPointUniform();
     
@@ -161,6 +194,18 @@ void Parameters::LoadFile() {
     this->SetNumberPDPPprotectionRoutes(auxInt);
     auxIfstream >> auxInt;
     this->SetNumberMPRGroups(auxInt);
+    auxIfstream >> auxInt;
+    this->SetNumberReplications(auxInt);
+    auxIfstream >> auxDouble;
+    this->SetReplicationsPrecision(auxDouble);
+    auxIfstream >> auxDouble;
+    this->SetNumberWarmUpReq(auxDouble);
+    auxIfstream >> auxDouble;
+    this->SetNumberTransientReq(auxDouble);
+    auxIfstream >> auxDouble;
+    this->SetNumberBatchReq(auxDouble);
+    auxIfstream >> auxDouble;
+    this->SetBatchPrecision(auxDouble);
 
     this->SetLoadPointUniform();
 }
@@ -356,3 +401,57 @@ void Parameters::SetNumberMPRGroups(unsigned int numberMPRGroups) {
     this->numberMPRGroups = numberMPRGroups;
 }
 
+unsigned int Parameters::GetNumberReplications() const {
+    return numberReplications;
+}
+
+void Parameters::SetNumberReplications(unsigned int numberReplications) {
+    assert(numberReplications > 0);
+    this->numberReplications = numberReplications;
+}
+
+double Parameters::GetReplicationsPrecision() const {
+    return replicationsPrecision;
+}
+
+void Parameters::SetReplicationsPrecision(double replicationsPrecision) {
+    assert(replicationsPrecision >= 0.0);
+    this->replicationsPrecision = replicationsPrecision;
+}
+
+double Parameters::GetNumberWarmUpReq() const {
+    return numberWarmUpReq;
+}
+
+void Parameters::SetNumberWarmUpReq(double numberWarmUpReq) {
+    assert(numberWarmUpReq >= 0.0);
+    this->numberWarmUpReq = numberWarmUpReq;
+}
+
+double Parameters::GetNumberTransientReq() const {
+    return numberTransientReq;
+}
+
+void Parameters::SetNumberTransientReq(double numberTransientReq) {
+    assert(numberTransientReq >= 0.0);
+    this->numberTransientReq = numberTransientReq;
+}
+
+double Parameters::GetNumberBatchReq() const {
+    return numberBatchReq;
+}
+
+void Parameters::SetNumberBatchReq(double numberBatchReq) {
+    assert(numberBatchReq >= 1.0);
+    this->numberBatchReq = numberBatchReq;
+}
+
+double Parameters::GetBatchPrecision() const {
+    return batchPrecision;
+}
+
+void Parameters::SetBatchPrecision(double batchPrecision) {
+    assert(batchPrecision >= 0.0);
+    this->batchPrecision = batchPrecision;
+}
+
@@ -0,0 +1,145 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   ResultWriter.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:39 PM
+ */
+
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "../../include/Data/ResultWriter.h"
+
+const std::uint32_t ResultWriter::version = 1;
+
+//File signature of the binary results.
+static const char resultSignature[8] = {'O', 'N', 'S', 'R', 'S', 'L', 'T',
+                                        '\0'};
+
+ResultTable::ResultTable(const std::string& name,
+std::initializer_list<std::pair<std::string, ResultColumnType>> columns)
+:name(name), columns(0), numRows(0) {
+
+    for(auto const& column: columns)
+        this->columns.push_back({column.first, column.second, {}});
+}
+
+void ResultTable::AddRow(std::initializer_list<double> values) {
+    assert(values.size() == this->columns.size());
+    auto it = values.begin();
+
+    for(auto& column: this->columns)
+        column.values.push_back(*it++);
+    numRows++;
+}
+
+const std::string& ResultTable::GetName() const {
+    return name;
+}
+
+const std::vector<ResultColumn>& ResultTable::GetColumns() const {
+    return columns;
+}
+
+std::size_t ResultTable::GetNumRows() const {
+    return numRows;
+}
+
+ResultWriter::ResultWriter()
+:tables() {
+
+}
+
+ResultWriter::~ResultWriter() {
+
+}
+
+void ResultWriter::AddTable(const ResultTable& table) {
+    this->tables.push_back(table);
+}
+
+void ResultWriter::WriteCsv(const std::string& fileName) const {
+    std::string buffer("Table,Row,Column,Value\n");
+    char value[32];
+
+    //The tables have different columns, so each cell is written in its own
+    //line.
+    for(auto const& table: this->tables){
+        const std::vector<ResultColumn>& columns = table.GetColumns();
+
+        for(std::size_t row = 0; row < table.GetNumRows(); row++){
+            for(auto const& column: columns){
+
+                if(column.type == ResultUnsigned)
+                    std::snprintf(value, sizeof(value), "%llu",
+                    (unsigned long long) column.values.at(row));
+                else
+                    std::snprintf(value, sizeof(value), "%.10g",
+                                  column.values.at(row));
+                buffer += table.GetName() + "," + std::to_string(row) + "," +
+                          column.name + "," + value + '\n';
+            }
+        }
+    }
+    ResultWriter::WriteFile(fileName, buffer);
+}
+
+void ResultWriter::WriteBinary(const std::string& fileName) const {
+    std::string buffer(resultSignature, sizeof(resultSignature));
+
+    ResultWriter::Append<std::uint32_t>(buffer, version);
+    ResultWriter::Append<std::uint32_t>(buffer, this->tables.size());
+
+    //Each table has its name, columns and number of rows, followed by the
+    //values of each column.
+    for(auto const& table: this->tables){
+        const std::vector<ResultColumn>& columns = table.GetColumns();
+
+        ResultWriter::Append<std::uint32_t>(buffer, table.GetName().size());
+        buffer += table.GetName();
+        ResultWriter::Append<std::uint32_t>(buffer, columns.size());
+        ResultWriter::Append<std::uint64_t>(buffer, table.GetNumRows());
+
+        for(auto const& column: columns){
+            ResultWriter::Append<std::uint32_t>(buffer, column.name.size());
+            buffer += column.name;
+            ResultWriter::Append<std::uint8_t>(buffer, column.type);
+        }
+
+        for(auto const& column: columns){
+            for(double value: column.values){
+
+                if(column.type == ResultUnsigned)
+                    ResultWriter::Append<std::uint64_t>(buffer, value);
+                else
+                    ResultWriter::Append<double>(buffer, value);
+            }
+        }
+    }
+    ResultWriter::WriteFile(fileName, buffer);
+}
+
+void ResultWriter::WriteFile(const std::string& fileName,
+const std::string& buffer) {
+    std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+
+    if(file.is_open())
+        file.write(buffer.data(), buffer.size());
+
+    if(!file.is_open() || !file)
+        std::cerr << "Unable to write the result file: " << fileName
+                  << std::endl;
+}
+
+template<class T>
+void ResultWriter::Append(std::string& buffer, T value) {
+    buffer.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
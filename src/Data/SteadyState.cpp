@@ -0,0 +1,147 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   SteadyState.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:32 PM
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "../../include/Data/SteadyState.h"
+#include "../../include/Data/Data.h"
+#include "../../include/Data/Parameters.h"
+#include "../../include/SimulationType/SimulationType.h"
+
+const unsigned int SteadyState::minNumBatches = 10;
+
+SteadyState::SteadyState(SimulationType* simulType)
+:simulType(simulType), steady(true), converged(false),
+transientOption(TransientDisabled), batchSize(0.0), transientSize(0.0),
+precision(0.0), batchStartReq(0.0), batchStartBloc(0.0), batches(0),
+sum(0.0), sumSquares(0.0) {
+
+}
+
+SteadyState::~SteadyState() {
+
+}
+
+void SteadyState::Initialize() {
+    Parameters* parameters = this->simulType->GetParameters();
+
+    this->transientOption = this->simulType->GetOptions()
+                                ->GetTransientOption();
+    this->steady = (this->transientOption == TransientDisabled);
+    this->batchSize = parameters->GetNumberBatchReq();
+    this->transientSize = parameters->GetNumberTransientReq();
+    this->precision = parameters->GetBatchPrecision();
+    this->Restart();
+}
+
+bool SteadyState::Update() {
+    Data* data = this->simulType->GetData();
+    double numBloc = data->GetNumberBlocReq();
+    double numReq = data->GetNumberAccReq() + numBloc;
+    double batchBP;
+
+    if(!this->steady && this->transientOption == TransientFixed &&
+    numReq >= this->transientSize){
+        this->steady = true;
+        return true;
+    }
+    if(numReq - this->batchStartReq < this->batchSize)
+        return false;
+
+    batchBP = (numBloc - this->batchStartBloc) /
+              (numReq - this->batchStartReq);
+    this->batches.push_back(batchBP);
+    this->sum += batchBP;
+    this->sumSquares += batchBP * batchBP;
+    this->batchStartReq = numReq;
+    this->batchStartBloc = numBloc;
+
+    if(this->steady)
+        this->CheckConvergence();
+    else if(this->transientOption == TransientMSER && this->CheckMSER()){
+        this->steady = true;
+        return true;
+    }
+
+    return false;
+}
+
+bool SteadyState::IsSteady() const {
+    return steady;
+}
+
+bool SteadyState::IsConverged() const {
+    return converged;
+}
+
+void SteadyState::Restart() {
+    Data* data = this->simulType->GetData();
+
+    this->converged = false;
+    this->batchStartBloc = data->GetNumberBlocReq();
+    this->batchStartReq = data->GetNumberAccReq() + this->batchStartBloc;
+    this->batches.clear();
+    this->sum = 0.0;
+    this->sumSquares = 0.0;
+}
+
+bool SteadyState::CheckMSER() const {
+    unsigned int numBatches = this->batches.size();
+    unsigned int bestTrunc = numBatches;
+    double bestValue = Def::Max_Double;
+    double sumTail = 0.0;
+    double sumSquaresTail = 0.0;
+    double numTail;
+    double value;
+
+    if(numBatches < minNumBatches)
+        return false;
+
+    //The sums of the batches after each truncation point are taken from
+    //the last batch to the first one.
+    for(unsigned int d = numBatches; d-- > 0;){
+        sumTail += this->batches.at(d);
+        sumSquaresTail += this->batches.at(d) * this->batches.at(d);
+
+        if(d > numBatches / 2)
+            continue;
+        numTail = numBatches - d;
+        value = (sumSquaresTail - sumTail * sumTail / numTail) /
+                (numTail * numTail);
+
+        if(value <= bestValue){
+            bestValue = value;
+            bestTrunc = d;
+        }
+    }
+
+    return bestTrunc < numBatches / 2;
+}
+
+void SteadyState::CheckConvergence() {
+    unsigned int numBatches = this->batches.size();
+    double mean;
+    double variance;
+
+    if(this->precision <= 0.0 || numBatches < minNumBatches)
+        return;
+
+    mean = this->sum / numBatches;
+    variance = (this->sumSquares - this->sum * mean) / (numBatches - 1);
+
+    if(mean > 0.0)
+        this->converged = Data::GetStudentQuantile(numBatches) *
+                          std::sqrt(std::max(variance, 0.0) / numBatches) <=
+                          this->precision * mean;
+}
@@ -0,0 +1,81 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   AliasTable.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 8:00 PM
+ */
+
+#include <cassert>
+#include <numeric>
+
+#include "../../include/GeneralClasses/AliasTable.h"
+
+AliasTable::AliasTable()
+:probabilities(0), aliases(0) {
+
+}
+
+void AliasTable::Create(const std::vector<double>& weights) {
+    unsigned int size = weights.size();
+    double sumWeights = std::accumulate(weights.begin(), weights.end(), 0.0);
+    std::vector<double> scaled(size);
+    std::vector<unsigned int> small;
+    std::vector<unsigned int> large;
+    unsigned int smallIndex, largeIndex;
+    assert(size > 0 && sumWeights > 0.0);
+
+    this->probabilities.assign(size, 1.0);
+    this->aliases.resize(size);
+
+    //Each index has a column of height size * probability. The columns
+    //smaller than 1 are filled by the larger ones, their aliases.
+    for(unsigned int a = 0; a < size; a++){
+        assert(weights.at(a) > 0.0);
+        scaled.at(a) = weights.at(a) * size / sumWeights;
+        this->aliases.at(a) = a;
+
+        if(scaled.at(a) < 1.0)
+            small.push_back(a);
+        else
+            large.push_back(a);
+    }
+
+    while(!small.empty() && !large.empty()){
+        smallIndex = small.back();
+        small.pop_back();
+        largeIndex = large.back();
+        large.pop_back();
+
+        this->probabilities.at(smallIndex) = scaled.at(smallIndex);
+        this->aliases.at(smallIndex) = largeIndex;
+        scaled.at(largeIndex) -= 1.0 - scaled.at(smallIndex);
+
+        if(scaled.at(largeIndex) < 1.0)
+            small.push_back(largeIndex);
+        else
+            large.push_back(largeIndex);
+    }
+    //The remaining columns are full, up to rounding errors, and keep the
+    //probability 1.
+}
+
+unsigned int AliasTable::Draw(RandomStreams::Engine& engine) const {
+    std::uniform_int_distribution<unsigned int> indexDistribution(0,
+    this->probabilities.size() - 1);
+    std::uniform_real_distribution<double> coinDistribution(0.0, 1.0);
+    unsigned int index = indexDistribution(engine);
+
+    if(coinDistribution(engine) < this->probabilities[index])
+        return index;
+    return this->aliases[index];
+}
+
+unsigned int AliasTable::GetSize() const {
+    return probabilities.size();
+}
@@ -19,6 +19,3 @@ unsigned int Def::Min_UnInt = std::numeric_limits<unsigned int>::lowest();
 unsigned int Def::Max_UnInt = std::numeric_limits<unsigned int>::max();
 double Def::Min_Double = std::numeric_limits<double>::lowest();
 double Def::Max_Double = std::numeric_limits<double>::max();
-std::random_device Def::randomDevice;
-std::default_random_engine Def::pseudoRandomEngine(0);
-std::default_random_engine Def::randomEngine(Def::randomDevice());
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   IndexPool.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 8:20 PM
+ */
+
+#include <cassert>
+#include <limits>
+
+#include "../../include/GeneralClasses/IndexPool.h"
+
+const unsigned int IndexPool::invalidPosition = 
+std::numeric_limits<unsigned int>::max();
+
+IndexPool::IndexPool()
+:indexes(0), positions(0) {
+
+}
+
+void IndexPool::Initialize(unsigned int size, bool full) {
+    this->indexes.clear();
+    this->positions.assign(size, invalidPosition);
+
+    if(full){
+        this->indexes.reserve(size);
+
+        for(unsigned int a = 0; a < size; a++)
+            this->Insert(a);
+    }
+}
+
+void IndexPool::Insert(unsigned int index) {
+    assert(!this->Contains(index));
+
+    this->positions[index] = this->indexes.size();
+    this->indexes.push_back(index);
+}
+
+void IndexPool::Remove(unsigned int index) {
+    assert(this->Contains(index));
+    unsigned int position = this->positions[index];
+    unsigned int lastIndex = this->indexes.back();
+
+    this->indexes[position] = lastIndex;
+    this->positions[lastIndex] = position;
+    this->indexes.pop_back();
+    this->positions[index] = invalidPosition;
+}
+
+bool IndexPool::Contains(unsigned int index) const {
+    assert(index < this->positions.size());
+
+    return this->positions[index] != invalidPosition;
+}
+
+unsigned int IndexPool::GetSize() const {
+    return indexes.size();
+}
+
+unsigned int IndexPool::GetIndex(unsigned int position) const {
+    assert(position < this->indexes.size());
+
+    return this->indexes[position];
+}
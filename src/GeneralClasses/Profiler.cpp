@@ -0,0 +1,163 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   Profiler.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:44 PM
+ */
+
+#include <array>
+#include <iomanip>
+#include <mutex>
+
+#include "../../include/GeneralClasses/Profiler.h"
+
+bool Profiler::enabled = false;
+
+std::chrono::steady_clock::time_point Profiler::resetTime =
+std::chrono::steady_clock::now();
+
+const boost::unordered_map<ProfilePhase, std::string>
+Profiler::mapProfilePhase = boost::assign::map_list_of
+    (PhaseEventQueue, "Event queue")
+    (PhaseRouting, "Routing")
+    (PhaseModulation, "Modulation")
+    (PhaseOSNR, "OSNR check")
+    (PhaseSpecAllocRandom, "Spectrum allocation Random")
+    (PhaseSpecAllocFF, "Spectrum allocation FF")
+    (PhaseSpecAllocMSCL, "Spectrum allocation MSCL")
+    (PhaseConnect, "Topology connect")
+    (PhaseRelease, "Topology release")
+    (PhaseFragmentation, "Fragmentation")
+    (PhaseStorageCall, "Data storage");
+
+const boost::unordered_map<ProfileCounter, std::string>
+Profiler::mapProfileCounter = boost::assign::map_list_of
+    (CounterEvents, "Events")
+    (CounterCandidateSlots, "Candidate slots");
+
+/**
+ * @brief Values accumulated by the profiler.
+ */
+struct ProfileValues {
+    std::array<std::uint64_t, LastProfilePhase + 1> times;
+    std::array<std::uint64_t, LastProfilePhase + 1> calls;
+    std::array<std::uint64_t, LastProfileCounter + 1> counters;
+
+    ProfileValues()
+    :times(), calls(), counters() {
+
+    }
+
+    void Add(const ProfileValues& values) {
+
+        for(unsigned int a = 0; a < times.size(); a++){
+            times.at(a) += values.times.at(a);
+            calls.at(a) += values.calls.at(a);
+        }
+        for(unsigned int a = 0; a < counters.size(); a++)
+            counters.at(a) += values.counters.at(a);
+    }
+};
+
+//Values of the finished threads.
+static ProfileValues profileTotals;
+static std::mutex profileMutex;
+
+/**
+ * @brief Values of a thread, added to the totals when the thread ends.
+ */
+struct ThreadProfileValues {
+    ProfileValues values;
+
+    ~ThreadProfileValues() {
+        std::lock_guard<std::mutex> lock(profileMutex);
+        profileTotals.Add(values);
+    }
+};
+
+static thread_local ThreadProfileValues threadValues;
+
+bool Profiler::IsBuilt() {
+#ifdef ONS_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Profiler::SetEnabled(bool enabled) {
+    Profiler::enabled = enabled;
+}
+
+bool Profiler::IsEnabled() {
+    return enabled;
+}
+
+void Profiler::Count(ProfileCounter counter, std::uint64_t value) {
+
+    if(enabled)
+        threadValues.values.counters[counter] += value;
+}
+
+void Profiler::AddTime(ProfilePhase phase, std::uint64_t nanoseconds) {
+    threadValues.values.times[phase] += nanoseconds;
+    threadValues.values.calls[phase]++;
+}
+
+void Profiler::Reset() {
+    std::lock_guard<std::mutex> lock(profileMutex);
+
+    profileTotals = ProfileValues();
+    threadValues.values = ProfileValues();
+    resetTime = std::chrono::steady_clock::now();
+}
+
+void Profiler::Report(std::ostream& ostream) {
+    std::lock_guard<std::mutex> lock(profileMutex);
+    double wallTime = std::chrono::duration<double>(
+                      std::chrono::steady_clock::now() - resetTime).count();
+    double numEvents;
+
+    profileTotals.Add(threadValues.values);
+    threadValues.values = ProfileValues();
+    numEvents = profileTotals.counters.at(CounterEvents);
+
+    ostream << "PROFILER" << std::endl;
+    ostream << "Wall time (s): " << wallTime << "  Events per second: "
+            << (wallTime > 0.0 ? numEvents / wallTime : 0.0) << std::endl;
+    ostream << std::left << std::setw(28) << "Phase" << std::right
+            << std::setw(14) << "Calls" << std::setw(14) << "Total (ms)"
+            << std::setw(14) << "ns/event" << std::setw(14) << "ns/call"
+            << std::endl;
+
+    for(ProfilePhase a = FirstProfilePhase; a <= LastProfilePhase;
+    a = ProfilePhase(a+1)){
+
+        if(profileTotals.calls.at(a) == 0)
+            continue;
+        ostream << std::left << std::setw(28) << mapProfilePhase.at(a)
+                << std::right << std::setw(14) << profileTotals.calls.at(a)
+                << std::setw(14) << profileTotals.times.at(a) / 1E6
+                << std::setw(14) << (numEvents > 0.0 ?
+                   profileTotals.times.at(a) / numEvents : 0.0)
+                << std::setw(14) << (double) profileTotals.times.at(a) /
+                   profileTotals.calls.at(a) << std::endl;
+    }
+
+    for(ProfileCounter a = FirstProfileCounter; a <= LastProfileCounter;
+    a = ProfileCounter(a+1)){
+        ostream << mapProfileCounter.at(a) << ": "
+                << profileTotals.counters.at(a);
+
+        if(a != CounterEvents && numEvents > 0.0)
+            ostream << "  (" << profileTotals.counters.at(a) / numEvents
+                    << " per event)";
+        ostream << std::endl;
+    }
+}
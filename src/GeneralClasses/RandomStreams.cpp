@@ -0,0 +1,96 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   RandomStreams.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 3:16 PM
+ */
+
+#include "../../include/GeneralClasses/RandomStreams.h"
+#include "../../include/SimulationType/SimulationType.h"
+#include "../../include/Data/Options.h"
+
+RandomStreams::RandomStreams(SimulationType* simulType)
+:simulType(simulType), seed(0), replication(0), engines(LastStream + 1) {
+    this->SetSeed(0);
+}
+
+RandomStreams::~RandomStreams() {
+    
+}
+
+void RandomStreams::Load() {
+    
+    switch(this->simulType->GetOptions()->GetGenerationOption()){
+        case GenerationSame:
+        case GenerationPseudoRandom:
+            this->SetSeed(0);
+            break;
+        case GenerationRandom:
+            this->SetSeed(std::random_device{}());
+            break;
+        default:
+            std::cerr << "Invalid random generation option" << std::endl;
+            std::abort();
+    }
+}
+
+void RandomStreams::SetSeed(unsigned int seed) {
+    this->seed = seed;
+    
+    for(RandomStream a = FirstStream; a <= LastStream; 
+    a = RandomStream(a+1))
+        this->RestartStream(a, 0);
+}
+
+unsigned int RandomStreams::GetSeed() const {
+    return seed;
+}
+
+void RandomStreams::RestartSimulStreams(unsigned int subIndex) {
+    
+    for(RandomStream a = FirstStream; a <= LastSimulStream; 
+    a = RandomStream(a+1))
+        this->RestartStream(a, subIndex);
+}
+
+void RandomStreams::SetReplication(unsigned int replication) {
+    this->replication = replication;
+}
+
+unsigned int RandomStreams::GetReplication() const {
+    return replication;
+}
+
+RandomStreams::Engine& RandomStreams::GetEngine(RandomStream stream) {
+    assert(stream >= FirstStream && stream <= LastStream);
+    
+    return engines[stream];
+}
+
+const std::vector<RandomStreams::Engine>& RandomStreams::GetEngines() const {
+    return engines;
+}
+
+void RandomStreams::SetEngines(const std::vector<Engine>& engines) {
+    assert(engines.size() == this->engines.size());
+    
+    this->engines = engines;
+}
+
+void RandomStreams::RestartStream(RandomStream stream, unsigned int subIndex) {
+    std::vector<unsigned int> seeds{this->seed, (unsigned int) stream, 
+                                    subIndex};
+    
+    //The first replication keeps the sequences of a single run.
+    if(this->replication != 0)
+        seeds.push_back(this->replication);
+    std::seed_seq seedSeq(seeds.begin(), seeds.end());
+    
+    engines[stream].seed(seedSeq);
+}
@@ -11,7 +11,14 @@
  * Created on August 2, 2018, 3:42 PM
  */
 
+#include <fstream>
+#include <sstream>
+#include <exception>
+
 #include "../include/Kernel.h"
+#include "../include/Data/InputOutput.h"
+#include "../include/Data/Options.h"
+#include "../include/GeneralClasses/Profiler.h"
 #include "../include/SimulationType/SimulationType.h"
 #include "../include/SimulationType/SimulationMultiLoad.h"
 #include "../include/SimulationType/SimulationGA.h"
@@ -27,7 +34,8 @@ Kernel::mapSimulationType = boost::assign::map_list_of
     (PsoSimulationType, "PSO Simulation");
 
 Kernel::Kernel()
-:numberSimulations(0), simulations(0) {
+:numberSimulations(0), simulations(0), batchSimulations(0), 
+helpRequested(false) {
     
 }
 
@@ -39,6 +47,76 @@ Kernel::~Kernel() {
 void Kernel::Run() {
     
     this->CreateSimulations();
+    this->RunSimulations();
+}
+
+int Kernel::Run(int argc, char** argv) {
+    
+    //An error of a simulation ends the simulator with an exit code, so the
+    //batch can be scheduled without a terminal.
+    try{
+        return this->RunArguments(argc, argv);
+    }
+    catch(const std::exception& exception){
+        std::cerr << "Simulation error: " << exception.what() << std::endl;
+        return ExitSimulationError;
+    }
+}
+
+ExitCode Kernel::RunArguments(int argc, char** argv) {
+    ExitCode exitCode;
+    
+    if(argc <= 1){
+        this->Run();
+        return ExitSuccess;
+    }
+    
+    exitCode = this->ReadArguments(argc, argv);
+    
+    if(exitCode != ExitSuccess){
+        Kernel::Help(std::cerr);
+        return exitCode;
+    }
+    if(this->helpRequested){
+        Kernel::Help(std::cout);
+        return ExitSuccess;
+    }
+    if(this->batchSimulations.empty()){
+        std::cerr << "No simulation to perform" << std::endl;
+        return ExitInvalidBatch;
+    }
+    
+    //The input files and output folders are checked before the first 
+    //simulation, so a batch does not fail in the middle. Only the files 
+    //written by a previous simulation of the batch are checked when used.
+    for(auto& it: this->batchSimulations){
+        if(!Kernel::CheckSimulationFiles(it.first))
+            return ExitMissingFile;
+    }
+    
+    InputOutput::SetInteractive(false);
+    this->numberSimulations = this->batchSimulations.size();
+    
+    //The output folders are opened when the simulations are created.
+    for(auto& it: this->batchSimulations)
+        this->CreateSimulation(it.first, it.second);
+    
+    //The other input files depend on the options of each simulation.
+    for(auto& it: this->simulations){
+        it->GetOptions()->LoadFile();
+        
+        if(!it->GetInputOutput()->CheckInputFiles())
+            exitCode = ExitMissingFile;
+    }
+    if(exitCode != ExitSuccess)
+        return exitCode;
+    
+    this->RunSimulations();
+    
+    return ExitSuccess;
+}
+
+void Kernel::RunSimulations() {
 
     for(auto& simulation: simulations){
         Pre_Simulation(simulation.get());
@@ -88,7 +166,15 @@ void Kernel::Pre_Simulation(SimulationType* simul) {
 void Kernel::Simulation(SimulationType* simul) {
     
     simul->Print();
+    
+    if(Profiler::IsEnabled())
+        Profiler::Reset();
     simul->Run();
+    
+    if(Profiler::IsEnabled()){
+        Profiler::Report(std::cout);
+        Profiler::Report(simul->GetInputOutput()->GetLogFile());
+    }
 }
 
 void Kernel::Pos_Simulation(SimulationType* simul) {
@@ -118,3 +204,224 @@ void Kernel::CreateSimulation(SimulIndex index, TypeSimulation type) {
             std::abort();
     }
 }
+
+std::ostream& Kernel::Help(std::ostream& ostream) {
+    ostream << "Usage: OpticalNetworkSimulator [-h] [-s TYPE]... "
+            << "[-b FILE]..." << std::endl
+            << "Without arguments, the simulations are read from the "
+            << "terminal." << std::endl
+            << "  -h, --help             Show this help." << std::endl
+            << "  -s, --simulation TYPE  Add a simulation of type TYPE." 
+            << std::endl
+            << "  -p, --profile          Report the time of the simulation "
+            << "phases." << std::endl
+            << "  -b, --batch FILE       Add the simulations of the batch "
+            << "file FILE." << std::endl
+            << "The simulations are indexed by their position, unless the "
+            << "batch file sets" << std::endl
+            << "the 'index' key. The index selects the Parameters_<index>, "
+            << "Options_<index>" << std::endl
+            << "and Outputs/<index> files." << std::endl
+            << "Batch file example:" << std::endl
+            << "  [simulation]" << std::endl
+            << "  type = 1" << std::endl
+            << "  index = 2" << std::endl
+            << "Simulation types:" << std::endl;
+    
+    for(TypeSimulation a = FirstSimulation; a <= LastSimulation; 
+    a = TypeSimulation(a+1)){
+        ostream << "  " << a << "-" << Kernel::mapSimulationType.at(a) 
+                << std::endl;
+    }
+    
+    ostream << "Exit codes: " << ExitSuccess << "-Success, " 
+            << ExitInvalidArguments << "-Invalid arguments, " 
+            << ExitInvalidBatch << "-Invalid batch, " 
+            << ExitMissingFile << "-Missing file, " 
+            << ExitSimulationError << "-Simulation error" << std::endl;
+    
+    return ostream;
+}
+
+ExitCode Kernel::ReadArguments(int argc, char** argv) {
+    std::string argument;
+    ExitCode exitCode;
+    unsigned int auxType;
+    
+    for(int a = 1; a < argc; a++){
+        argument = argv[a];
+        
+        if(argument == "-h" || argument == "--help"){
+            this->helpRequested = true;
+            continue;
+        }
+        if(argument == "-p" || argument == "--profile"){
+            
+            if(!Profiler::IsBuilt())
+                std::cerr << "The profiler is not built in this binary, "
+                          << "configure it with ONS_PROFILER" << std::endl;
+            Profiler::SetEnabled(Profiler::IsBuilt());
+            continue;
+        }
+        
+        if(a + 1 == argc){
+            std::cerr << "Invalid argument: " << argument << std::endl;
+            return ExitInvalidArguments;
+        }
+        
+        if(argument == "-s" || argument == "--simulation"){
+            std::istringstream auxStream(argv[++a]);
+            
+            if(!(auxStream >> auxType) || !auxStream.eof() ||
+            !this->AddBatchSimulation(0, auxType)){
+                std::cerr << "Invalid simulation type: " << argv[a] 
+                          << std::endl;
+                return ExitInvalidArguments;
+            }
+        }
+        else if(argument == "-b" || argument == "--batch"){
+            exitCode = this->ReadBatchFile(argv[++a]);
+            
+            if(exitCode != ExitSuccess)
+                return exitCode;
+        }
+        else{
+            std::cerr << "Invalid argument: " << argument << std::endl;
+            return ExitInvalidArguments;
+        }
+    }
+    
+    return ExitSuccess;
+}
+
+ExitCode Kernel::ReadBatchFile(const std::string& fileName) {
+    std::ifstream batchFile(fileName);
+    std::string line, key, value;
+    unsigned int lineNumber = 0;
+    unsigned int auxValue;
+    bool inSimulation = false;
+    bool hasType = false;
+    SimulIndex auxIndex = 0;
+    unsigned int auxType = 0;
+    std::size_t pos;
+    
+    if(!batchFile.is_open()){
+        std::cerr << "Wrong batch file: " << fileName << std::endl;
+        return ExitMissingFile;
+    }
+    
+    //The last simulation is added by the empty section after the file end.
+    while(true){
+        bool endFile = !std::getline(batchFile, line);
+        lineNumber++;
+        
+        if(endFile)
+            line = "[simulation]";
+        
+        pos = line.find_first_of("#;");
+        if(pos != std::string::npos)
+            line.erase(pos);
+        line.erase(0, line.find_first_not_of(" \t\r"));
+        line.erase(line.find_last_not_of(" \t\r") + 1);
+        
+        if(line.empty())
+            continue;
+        
+        if(line == "[simulation]"){
+            
+            if(inSimulation && (!hasType || 
+            !this->AddBatchSimulation(auxIndex, auxType))){
+                std::cerr << "Invalid simulation before line " << lineNumber 
+                          << " of " << fileName << std::endl;
+                return ExitInvalidBatch;
+            }
+            if(endFile)
+                break;
+            
+            inSimulation = true;
+            hasType = false;
+            auxIndex = 0;
+            continue;
+        }
+        
+        pos = line.find('=');
+        if(!inSimulation || pos == std::string::npos){
+            std::cerr << "Invalid line " << lineNumber << " of " << fileName
+                      << ": " << line << std::endl;
+            return ExitInvalidBatch;
+        }
+        
+        key = line.substr(0, pos);
+        key.erase(key.find_last_not_of(" \t") + 1);
+        value = line.substr(pos + 1);
+        std::istringstream auxStream(value);
+        
+        if(!(auxStream >> auxValue) || !(auxStream >> std::ws).eof()){
+            std::cerr << "Invalid value in line " << lineNumber << " of " 
+                      << fileName << ": " << value << std::endl;
+            return ExitInvalidBatch;
+        }
+        
+        if(key == "type"){
+            auxType = auxValue;
+            hasType = true;
+        }
+        else if(key == "index"){
+            
+            if(auxValue == 0){
+                std::cerr << "Invalid index in line " << lineNumber << " of "
+                          << fileName << std::endl;
+                return ExitInvalidBatch;
+            }
+            auxIndex = auxValue;
+        }
+        else{
+            std::cerr << "Invalid key in line " << lineNumber << " of " 
+                      << fileName << ": " << key << std::endl;
+            return ExitInvalidBatch;
+        }
+    }
+    
+    return ExitSuccess;
+}
+
+bool Kernel::AddBatchSimulation(SimulIndex index, unsigned int type) {
+    
+    if(type < FirstSimulation || type > LastSimulation)
+        return false;
+    
+    if(index == 0)
+        index = this->batchSimulations.size() + 1;
+    
+    //Simulations with the same index would write the same output files.
+    for(auto& it: this->batchSimulations){
+        if(it.first == index){
+            std::cerr << "Repeated simulation index: " << index << std::endl;
+            return false;
+        }
+    }
+    
+    this->batchSimulations.push_back(std::make_pair(index, 
+    (TypeSimulation) type));
+    
+    return true;
+}
+
+bool Kernel::CheckSimulationFiles(SimulIndex index) {
+    std::vector<std::string> fileNames = {
+        "Files/Inputs/Parameters_" + std::to_string(index) + ".txt",
+        "Files/Inputs/Options_" + std::to_string(index) + ".txt"
+    };
+    
+    for(auto& it: fileNames){
+        std::ifstream auxFile(it);
+        
+        if(!auxFile.is_open()){
+            std::cerr << "Missing file of simulation " << index << ": " << it
+                      << std::endl;
+            return false;
+        }
+    }
+    
+    return true;
+}
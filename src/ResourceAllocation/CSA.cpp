@@ -17,6 +17,10 @@
 #include "../../include/ResourceAllocation/Route.h"
 #include "../../include/ResourceAllocation/ResourceAlloc.h"
 #include "../../include/Structure/Topology.h"
+#include "../../include/Structure/Node.h"
+#include "../../include/Structure/SlotMask.h"
+#include "../../include/GeneralClasses/Def.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 CSA::CSA(ResourceAlloc* rsa, SpectrumAllocationOption option,Topology* topology)
 :SA(rsa, option, topology){
@@ -30,12 +34,16 @@ CSA::~CSA() {
 void CSA::SpecAllocation(Call* call) {
     
     switch(specAllOption){
-        case SpecAllFF:
+        case SpecAllFF:{
+            PROFILE_SCOPE(PhaseSpecAllocFF);
             this->FirstFit(call);
             break;
-        case SpecAllMSCL:
+        }
+        case SpecAllMSCL:{
+            PROFILE_SCOPE(PhaseSpecAllocMSCL);
             this->MSCL(call);
             break;
+        }
         default:
             std::cerr << "Invalid spectrum allocation option" << std::endl;
             std::abort();
@@ -44,131 +52,87 @@ void CSA::SpecAllocation(Call* call) {
 
 void CSA::FirstFit(Call* call){
     Route* route = call->GetRoute();
-    bool flag = false;
-    int numSlotsReq = call->GetNumberSlots();
-    int slot_range = this->GetTopology()->GetNumSlots() - numSlotsReq + 1;
+    unsigned int numSlotsReq = call->GetNumberSlots();
+    std::vector<SlotMask> vecDisp = resourceAlloc->GetDispMasks(route);
+    SlotIndex firstSlot;
     
     //Tries to find a set of available slots in a core- vary slots and later 
     //cores
-    for(unsigned int core = 0; core < this->GetTopology()->GetNumCores(); 
-    core++){
-        for(int s = 0; s < slot_range; s++){
-            if(resourceAlloc->CheckSlotsDispCore(route, s, s + 
-            call->GetNumberSlots() - 1, core)){
-                call->SetFirstSlot(s);
-                call->SetLastSlot(s + call->GetNumberSlots() - 1);
-                call->SetCore(core);
-                flag = true;
-                break;
-            }
-        }
-        if(flag)
+    for(CoreIndex core = 0; core < vecDisp.size(); core++){
+        firstSlot = vecDisp.at(core).FindFirstBlock(numSlotsReq);
+        
+        if(firstSlot != Def::Max_UnInt){
+            call->SetFirstSlot(firstSlot);
+            call->SetLastSlot(firstSlot + numSlotsReq - 1);
+            call->SetCore(core);
             break;
+        }
     }
 }
 
 void CSA::MSCL(Call* call){
-    /*Set Interfering routes to aplly Multicore MSCL*/
-    //this->SA::GetResourceAlloc()->SetInterferingRoutes();
-    int totalSlots=this->GetTopology()->GetNumSlots(),s,core;
-    Route *route = call->GetRoute(), *route_aux;
-    int NslotsReq = call->GetNumberSlots(),slot_range = 
-    totalSlots - NslotsReq + 1;
-    int core_size = this->GetTopology()->GetNumCores(),orNode = 
-    route->GetOrNodeId(),desNode = route->GetDeNodeId();
-    //Ponteiro que receberá todas as rotas que interferem com route
-    std::vector<std::shared_ptr<Route>> RouteInt = this->SA::GetResourceAlloc()
-    ->GetInterRoutes(orNode,desNode,0);
-    //int a = RouteInt.size();
-    int vetCapInic,vetCapFin,si;
-    double perda, perdaMin = std::numeric_limits<double>::max();
-    Topology* topology = this->GetTopology();
-    //Vetor de disponibilidade das rotas que interferem
-    bool vetDispInt[totalSlots],vetDispFin[totalSlots];
-    //Route* q = RouteInt.at(0);
-    //q->print();
-    //Route* p = RouteInt.at(1);
-    //p->print();
-    //route->print();
-
-    //Obtem quais slots podem começar a requisição:
-    bool DispFitSi = false;
-    //Percorre os núcleos que possuem disponibilidade para alocar a requisição
-        for(int e = 0;e < core_size;e++){
-            //Verifica quais conjuntos de slots podem ser alocados
-            for(s = 0; s < slot_range; s++){
-                perda = 0.0;
-                DispFitSi = resourceAlloc->CheckSlotsDispCore(route, s,
-                s + NslotsReq - 1,e);
-                if(DispFitSi == true){
-                    //Percorre rotas interferentes
-	 	    for(unsigned int r = 0; r <= RouteInt.size(); r++){
-                        if(r == RouteInt.size())
-                            route_aux = route;
-                        else
-                            route_aux = RouteInt.at(0).get();
-                        for(int se = 0;se < totalSlots;se++){
-				if(!(resourceAlloc->CheckSlotsDispCore(route_aux,
-                                se,se,e))){
-					vetDispInt[se] = false;
-					vetDispFin[se] = false;
-				}
-				else{
-					vetDispInt[se] = true;
-					if(se >= s && se < s + NslotsReq)
-                                            vetDispFin[se] = false;
-                                        else
-                                            vetDispFin[se] = true;
-				}
-			}
-			vetCapInic = 0;
-			vetCapFin  = 0;
-			//Calcula a capacidade inicial baseada no número de 
-                        //formas de alocação,requisições->2,4,8
-			for(int b=2; b <= 8; b++){
-                            if(b == 2 || b == 4 || b == 8)
-                                vetCapInic += this->SA::CalcNumFormAloc(b,
-                                vetDispInt,totalSlots);
-			}
-			//Requisições->2,4,8
-			for(int d=2; d <= 8; d++){
-			    if(d == 2 || d == 4 || d == 8)
-                                vetCapFin += this->SA::CalcNumFormAloc(d,
-                                vetDispFin,totalSlots);
-			}
-							
-                            /*
-							for(int b=2; b <= 5; b = b + 1){
-								  vetCapInic += Heuristics::calcNumFormAloc(b,vetDispInt,Topology::getNumSlots());
-							}
-							for(int d=2; d <= 5; d = d + 1){
-								 vetCapFin += Heuristics::calcNumFormAloc(d,vetDispFin,Topology::getNumSlots());
-							}*/
-			perda += vetCapInic - vetCapFin;
-		    }//Fim da verificação das rotas interferentes
-		    if(perda < perdaMin){
-		        perdaMin = perda;
-		        core = e;
-		        si = s;
-		    }
-		}
-            }//Fim da verificação dos slots
-        }//Fim da verificação dos núcleos
-        if(perdaMin < std::numeric_limits<double>::max()){
-            call->SetFirstSlot(si);
-            call->SetLastSlot(si+NslotsReq-1);
-            call->SetCore(core);
-            /*if(numSlotsReq == 2){
-                Def::numReq_Acc_2slots.at(core)++;
+    unsigned int numSlotsReq = call->GetNumberSlots();
+    Route* route = call->GetRoute();
+    Route* auxRoute;
+    unsigned int orNode = route->GetOrNode()->GetNodeId();
+    unsigned int deNode = route->GetDeNode()->GetNodeId();
+    
+    const std::vector<std::shared_ptr<Route>>& intRoutes =
+    this->resourceAlloc->GetInterRoutes(orNode, deNode, route);
+    unsigned int numInterRoutesCheck =
+    this->resourceAlloc->GetNumInterRoutesToCheck(orNode, deNode, route);
+    const std::vector<unsigned>& vecTrafficSlots = 
+    this->resourceAlloc->GetNumSlotsTraffic();
+    
+    double perda, perdaMin = Def::Max_Double;
+    SlotIndex si = Def::Max_UnInt;
+    CoreIndex core = 0;
+    
+    //Availability masks of the call route and its interfering routes, 
+    //indexed by route and core.
+    std::vector<std::vector<SlotMask>> vecDisp;
+    vecDisp.reserve(numInterRoutesCheck+1);
+    for(unsigned int a = 0; a <= numInterRoutesCheck; a++){
+        if(a != 0)
+            auxRoute = intRoutes.at(a-1).get();
+        else
+            auxRoute = route;
+        
+        vecDisp.push_back(resourceAlloc->GetDispMasks(auxRoute));
+    }
+    
+    //Candidates are evaluated core by core, in the slots order, so the 
+    //first option with minimum loss is the one of lowest core and slot.
+    for(CoreIndex e = 0; e < vecDisp.front().size(); e++){
+        SlotMask candidates = vecDisp.front().at(e).GetBlocksStart(
+                              numSlotsReq);
+        
+        for(SlotIndex s = candidates.FindNext(0); s != Def::Max_UnInt; 
+        s = candidates.FindNext(s + 1)){
+            PROFILE_COUNT(CounterCandidateSlots, 1);
+            perda = 0.0;
+            
+            for(unsigned int r = 0; r <= numInterRoutesCheck; r++){
+                //Calculates the requisition allocation impact in the 
+                //interfering routes for each set of slots
+                perda += this->CalcCapacityLoss(vecDisp.at(r).at(e), s, 
+                         s + numSlotsReq - 1, vecTrafficSlots);
+                
+                if(perda >= perdaMin)
+                    break;
             }
-            if(numSlotsReq == 4){
-                Def::numReq_Acc_4slots.at(core)++;
+            
+            if(perda < perdaMin){
+                perdaMin = perda;
+                si = s;
+                core = e;
             }
-            if(numSlotsReq == 8){
-                Def::numReq_Acc_8slots.at(core)++;
-            }*/
         }
+    }
+    
+    if(perdaMin < Def::Max_Double){
+        call->SetFirstSlot(si);
+        call->SetLastSlot(si + numSlotsReq - 1);
+        call->SetCore(core);
+    }
 }
-
-
-
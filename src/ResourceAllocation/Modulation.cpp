@@ -18,6 +18,7 @@
 #include "../../include/Data/Options.h"
 #include "../../include/ResourceAllocation/ResourceAlloc.h"
 #include "../../include/ResourceAllocation/Resources.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 const boost::unordered_map<TypeModulation, unsigned int> 
 Modulation::mapNumBitsModulation = boost::assign::map_list_of
@@ -40,17 +41,14 @@ Modulation::~Modulation() {
 }
 
 void Modulation::SetModulationParam(Call* call) {
-    double bandwidth, OSNRth;
-    unsigned int numSlots;
-    TypeModulation modulationFormat = call->GetModulation();
-    double bitRate = call->GetBitRate();
+    PROFILE_SCOPE(PhaseModulation);
+    DemandParam demand = this->GetDemandParam(call->GetModulation(), 
+                                              call->GetBitRate());
     
-    numSlots = this->GetNumberSlots(modulationFormat, bitRate, bandwidth);
-    call->SetBandwidth(bandwidth);
-    call->SetNumberSlots(numSlots);
+    call->SetBandwidth(demand.bandwidth);
+    call->SetNumberSlots(demand.numSlots);
     call->SetTotalNumSlots();
-    OSNRth = this->GetOSNRQAM(modulationFormat, bitRate);
-    call->SetOsnrTh(OSNRth);
+    call->SetOsnrTh(demand.osnrTh);
 }
 
 void Modulation::SetModulationParam(CallDevices* call) {
@@ -67,6 +65,35 @@ void Modulation::SetModulationParam(CallDevices* call) {
     }
 }
 
+void Modulation::CreateDemandTable(const std::vector<double>& bitRates) {
+    this->demandBitRates = bitRates;
+    this->demandTable.assign(LastModulation + 1, 
+                             std::vector<DemandParam>(0));
+    
+    for(TypeModulation mod = FirstModulation; mod <= LastModulation; 
+    mod = TypeModulation(mod+1)){
+        for(auto bitRate: bitRates)
+            this->demandTable.at(mod).push_back(this->CalcDemandParam(mod, 
+                                                                   bitRate));
+    }
+}
+
+DemandParam Modulation::GetDemandParam(TypeModulation modulation, 
+double bitRate) {
+    
+    //The traffic has few bit rates, so they are searched in order.
+    if(modulation >= FirstModulation && modulation <= LastModulation &&
+    !this->demandTable.empty()){
+        for(unsigned int a = 0; a < this->demandBitRates.size(); a++){
+            
+            if(this->demandBitRates[a] == bitRate)
+                return this->demandTable[modulation][a];
+        }
+    }
+    
+    return this->CalcDemandParam(modulation, bitRate);
+}
+
 std::vector<unsigned int> Modulation::GetPossibleSlots(std::vector<double> 
                                                        traffic) {
     std::vector<unsigned int> posSlots(0);
@@ -291,6 +318,17 @@ std::vector<double>& traffic) {
     return posSlots;
 }
 
+DemandParam Modulation::CalcDemandParam(TypeModulation modulation, 
+double bitRate) {
+    DemandParam demand;
+    
+    demand.numSlots = this->GetNumberSlots(modulation, bitRate, 
+                                           demand.bandwidth);
+    demand.osnrTh = this->GetOSNRQAM(modulation, bitRate);
+    
+    return demand;
+}
+
 unsigned int Modulation::GetNumBits(TypeModulation modulation) {
     return mapNumBitsModulation.at(modulation);
 }
\ No newline at end of file
@@ -131,94 +131,12 @@ void DedicatedPathProtection::SpecRoutingDPP(CallDevices* call) {
 
     //seting 2 protection calls to allocation
     std::vector<std::shared_ptr<Call>> callsVec = call->GetTranspSegmentsVec();
-    std::shared_ptr<Call> callWork0 = callsVec.at(0);
-    std::shared_ptr<Call> callWork1 = callsVec.at(1);
 
-    //call->RepeatModulation();
-    unsigned int numRoutes = call->GetNumRoutes();
     call->SetCore(0);
-    bool allocCallWork0Found = false;
-    bool allocCallWork1Found = false;
-
-    const unsigned int topNumSlots = topology->GetNumSlots();
     std::vector<unsigned int> possibleSlots(0);
     possibleSlots = this->resDevAlloc->specAlloc->SpecAllocation();
-    unsigned int auxSlot0 = 0;
-    unsigned int auxSlot1 = 0;
-
-    //slot loop for callWork0
-    for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-        auxSlot0 = possibleSlots.at(s0);
-
-        for (unsigned int k = 0; k < numRoutes; k++) {
-            callWork0->SetRoute(call->GetRoute(k));
-            callWork0->SetModulation(FixedModulation);
-
-            //getting protection routes to use in next loop (FOR)
-            std::deque <std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-            ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                                         std::end(ProtRoutes), nullptr),std::end(ProtRoutes));
-            unsigned int sizeProtRoutes = ProtRoutes.size();
 
-            //calculate number of slots for current of call
-            this->modulation->SetModulationParam(callWork0.get());
-
-            if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                continue;
-            //checking if callWork0 number of slots are available in its route
-            if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                           auxSlot0 +callWork0->GetNumberSlots() -1)) {
-                callWork0->SetFirstSlot(auxSlot0);
-                callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                callWork0->SetCore(0);
-
-                if (sizeProtRoutes >= 1) {  //if to skip case which it is no routes enough
-                    for (unsigned int s1 = 0; s1 < possibleSlots.size(); s1++) {
-                        auxSlot1 = possibleSlots.at(s1);
-                        for (unsigned int kd0 = 0; kd0 < sizeProtRoutes; kd0++) {
-                            if (call->GetProtRoute(k, kd0)) {  //if to avoid null route pointer
-                                callWork1->SetRoute(call->GetProtRoute(k, kd0));
-                                callWork1->SetModulation(FixedModulation);
-
-                                this->modulation->SetModulationParam(callWork1.get());
-
-                                if (auxSlot1 + callWork1->GetNumberSlots() - 1 >= topNumSlots)
-                                    continue;
-                                //checking if callWork1 slots are available in its route
-                                if (this->resDevAlloc->CheckSlotsDisp(callWork1->GetRoute(), auxSlot1,
-                                        auxSlot1 + callWork1->GetNumberSlots() - 1)) {
-                                    callWork1->SetFirstSlot(auxSlot1);
-                                    callWork1->SetLastSlot(auxSlot1 + callWork1->GetNumberSlots() - 1);
-                                    callWork1->SetCore(0);
-
-                                    call->SetRoute(call->GetRoute(k));
-                                    call->SetModulation(FixedModulation);
-                                    call->SetFirstSlot(callWork0->GetFirstSlot());
-                                    call->SetLastSlot(callWork0->GetLastSlot());
-                                    call->ClearTrialRoutes();
-                                    call->ClearTrialProtRoutes();
-                                    call->SetStatus(Accepted);
-                                    //increment proCalls counter
-                                    resDevAlloc->simulType->GetData()->SetProtectedCalls();
-                                    CalcBetaAverage(call);
-                                    CalcAlpha(call);
-                                    allocCallWork0Found = true;
-                                    allocCallWork1Found = true;
-                                    break;
-                                }
-                            }
-                        }
-                        if (allocCallWork1Found)
-                            break;
-                    }
-                }
-            }
-            if (allocCallWork0Found)
-                break;
-        }
-        if (allocCallWork0Found)
-            break;
-    }
+    this->AllocateMultiPath(call, callsVec, possibleSlots);
 
     /*if(allocCallWork0Found == false)
     //Delete one route and try allocating just 1 route (without protection)
@@ -0,0 +1,150 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/* 
+ * File:   MultiPathAlloc.cpp
+ * Author: agent
+ * 
+ * Created on October 17, 2026, 7:11 PM
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include "../../../include/ResourceAllocation/ProtectionSchemes/MultiPathAlloc.h"
+#include "../../../include/ResourceAllocation/ResourceAlloc.h"
+#include "../../../include/ResourceAllocation/Route.h"
+#include "../../../include/Calls/CallDevices.h"
+#include "../../../include/Structure/SlotMask.h"
+
+MultiPathAlloc::MultiPathAlloc(ResourceAlloc* resourceAlloc)
+:resourceAlloc(resourceAlloc), firstIndexes() {
+    
+}
+
+MultiPathAlloc::~MultiPathAlloc() {
+    
+}
+
+bool MultiPathAlloc::FindFirst(CallDevices* call, 
+const std::vector<unsigned int>& numSlots, 
+const std::vector<unsigned int>& possibleSlots, 
+MultiPathSolution& solution) {
+    assert(numSlots.size() == 2 || numSlots.size() == 3);
+    unsigned int numRoutes = call->GetNumRoutes();
+    unsigned int bestIndex = Def::Max_UnInt;
+    unsigned int index;
+    Route* route;
+    MultiPathSolution auxSolution;
+    
+    this->firstIndexes.clear();
+    
+    //The first working route with the lowest slot index is taken, as in the
+    //loops of the possible slots and of the working routes.
+    for(unsigned int k = 0; k < numRoutes; k++){
+        route = call->GetRoute(k).get();
+        
+        if(!route)
+            continue;
+        index = this->FindFirstIndex(route, numSlots.front(), possibleSlots);
+        
+        if(index >= bestIndex)
+            continue;
+        auxSolution.routeIndex = k;
+        
+        if(this->FindProtection(call, numSlots, possibleSlots, auxSolution)){
+            bestIndex = index;
+            solution = auxSolution;
+            solution.firstSlots.front() = possibleSlots.at(index);
+        }
+    }
+    
+    return bestIndex != Def::Max_UnInt;
+}
+
+bool MultiPathAlloc::FindProtection(CallDevices* call, 
+const std::vector<unsigned int>& numSlots, 
+const std::vector<unsigned int>& possibleSlots, 
+MultiPathSolution& solution) {
+    const std::deque<std::shared_ptr<Route>>& protRoutes = 
+    call->GetProtRoutes(solution.routeIndex);
+    unsigned int numProtRoutes = protRoutes.size() - std::count(
+    protRoutes.begin(), protRoutes.end(), nullptr);
+    unsigned int bestIndex = Def::Max_UnInt;
+    unsigned int bestInnerIndex, index, innerIndex;
+    unsigned int kd1Found = 0;
+    
+    if(numProtRoutes < numSlots.size() - 1)
+        return false;
+    
+    for(unsigned int kd0 = 0; kd0 < numProtRoutes; kd0++){
+        
+        if(!protRoutes.at(kd0))
+            continue;
+        index = this->FindFirstIndex(protRoutes.at(kd0).get(), numSlots.at(1),
+                                     possibleSlots);
+        
+        if(index >= bestIndex)
+            continue;
+        
+        //With two protection paths, the second one is the first route, 
+        //different from the first path route, with the lowest slot index.
+        if(numSlots.size() == 3){
+            bestInnerIndex = Def::Max_UnInt;
+            
+            for(unsigned int kd1 = 0; kd1 < numProtRoutes; kd1++){
+                
+                if(kd1 == kd0 || !protRoutes.at(kd1))
+                    continue;
+                innerIndex = this->FindFirstIndex(protRoutes.at(kd1).get(),
+                                                  numSlots.at(2), 
+                                                  possibleSlots);
+                
+                if(innerIndex < bestInnerIndex){
+                    bestInnerIndex = innerIndex;
+                    kd1Found = kd1;
+                }
+            }
+            
+            if(bestInnerIndex == Def::Max_UnInt)
+                continue;
+            solution.protRouteIndexes = {kd0, kd1Found};
+            solution.firstSlots = {0, possibleSlots.at(index), 
+                                   possibleSlots.at(bestInnerIndex)};
+        }
+        else{
+            solution.protRouteIndexes = {kd0};
+            solution.firstSlots = {0, possibleSlots.at(index)};
+        }
+        bestIndex = index;
+    }
+    
+    return bestIndex != Def::Max_UnInt;
+}
+
+unsigned int MultiPathAlloc::FindFirstIndex(Route* route, 
+unsigned int numSlots, const std::vector<unsigned int>& possibleSlots) {
+    auto key = std::make_pair(route, numSlots);
+    auto it = this->firstIndexes.find(key);
+    
+    if(it != this->firstIndexes.end())
+        return it->second;
+    
+    SlotMask blocksStart = this->resourceAlloc->GetDispMask(route, 0)
+                           .GetBlocksStart(numSlots);
+    unsigned int index = Def::Max_UnInt;
+    
+    for(unsigned int a = 0; a < possibleSlots.size(); a++){
+        
+        if(blocksStart.Test(possibleSlots.at(a))){
+            index = a;
+            break;
+        }
+    }
+    this->firstIndexes.emplace(key, index);
+    
+    return index;
+}
@@ -502,264 +502,26 @@ void PartitioningDedicatedPathProtection::SpecRoutingPDPP(CallDevices* call) {
         std::vector<std::shared_ptr<Call>> callsVec = call->GetTranspSegmentsVec();
         std::shared_ptr<Call> callWork0 = callsVec.at(0);
         std::shared_ptr<Call> callWork1 = callsVec.at(1);
-        std::shared_ptr<Call> callWork2 = callsVec.at(2);
 
-        //call->RepeatModulation();
-        unsigned int numRoutes = call->GetNumRoutes();
         call->SetCore(0);
-        bool allocCallWork0Found = false;
-        bool allocCallWork1Found = false;
-        bool allocCallWork2Found = false;
-        unsigned int auxSlot0;
-        unsigned int auxSlot1;
-        unsigned int auxSlot2;
-        const unsigned int topNumSlots = topology->GetNumSlots();
         std::vector<unsigned int> possibleSlots(0);
         possibleSlots = this->resDevAlloc->specAlloc->SpecAllocation();
 
-        //slot loop for callWork0
-        for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-            auxSlot0 = possibleSlots.at(s0);
-
-            //try allocating with 3 routes
-            for (unsigned int k = 0; k < numRoutes; k++) {
-                callWork0->SetRoute(call->GetRoute(k));
-                callWork0->SetModulation(FixedModulation);
-
-                //getting protection routes to use in next loop (FOR)
-                std::deque<std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-                ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                          std::end(ProtRoutes), nullptr), std::end(ProtRoutes));
-                unsigned int sizeProtRoutes = ProtRoutes.size();
-
-                //calculate number of slots for current of call
-                this->modulation->SetModulationParam(callWork0.get());
-
-                if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                    continue;
-                //checking if callWork0 number of slots are available in its route
-                if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                     auxSlot0 + callWork0->GetNumberSlots() - 1)) {
-                    callWork0->SetFirstSlot(auxSlot0);
-                    callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                    callWork0->SetCore(0);
-
-                    if (sizeProtRoutes >= 2) {  //if to skip case which it is no routes enough
-
-                        //slot loop for callWork1
-                        for (unsigned int s1 = 0; s1 < possibleSlots.size(); s1++) {
-                                auxSlot1 = possibleSlots.at(s1);
-                            for (unsigned int kd0 = 0; kd0 < sizeProtRoutes; kd0++) {
-                                if (call->GetProtRoute(k, kd0)) {  //if to avoid null route pointer
-                                    callWork1->SetRoute(call->GetProtRoute(k, kd0));
-                                    callWork1->SetModulation(FixedModulation);
-
-                                    this->modulation->SetModulationParam(callWork1.get());
-                                    if (auxSlot1 + callWork1->GetNumberSlots() - 1 >= topNumSlots)
-                                        continue;
-                                    //checking if callWork1 slots are available in its route
-                                    if (this->resDevAlloc->CheckSlotsDisp(callWork1->GetRoute(), auxSlot1,
-                                            auxSlot1 + callWork1->GetNumberSlots() - 1)) {
-                                        callWork1->SetFirstSlot(auxSlot1);
-                                        callWork1->SetLastSlot(auxSlot1 + callWork1->GetNumberSlots() -1);
-                                        callWork1->SetCore(0);
-
-                                        //slot loop for callWork2
-                                        for (unsigned int s2 = 0; s2 < possibleSlots.size(); s2++) {auxSlot2 = possibleSlots.at(s2);
-
-                                            for (unsigned int kd1 = 0; kd1 < sizeProtRoutes; kd1++) {
-                                                if (kd0 == kd1)
-                                                    continue;
-                                                callWork2->SetRoute(call->GetProtRoute(k, kd1));
-                                                callWork2->SetModulation(FixedModulation);
-
-                                                this->modulation->SetModulationParam(callWork2.get());
-
-                                                if (auxSlot2 + callWork2->GetNumberSlots() - 1 >= topNumSlots)
-                                                    continue;
-                                                //checking if callWork2 slots are available in its route
-                                                if (this->resDevAlloc->CheckSlotsDisp(callWork2->GetRoute(), auxSlot2,
-                                                        auxSlot2 + callWork2->GetNumberSlots() - 1)) {
-                                                    callWork2->SetFirstSlot(auxSlot2);
-                                                    callWork2->SetLastSlot(auxSlot2 +
-                                                                        callWork2->GetNumberSlots() - 1);
-                                                    callWork2->SetCore(0);
-
-                                                    call->SetRoute(call->GetRoute(k));
-                                                    call->SetModulation(FixedModulation);
-                                                    call->SetFirstSlot(callWork0->GetFirstSlot());
-                                                    call->SetLastSlot(callWork0->GetLastSlot());
-                                                    call->ClearTrialRoutes();
-                                                    call->ClearTrialProtRoutes();
-                                                    call->SetStatus(Accepted);
-                                                    //increment proCalls counter
-                                                    resDevAlloc->simulType->GetData()->SetProtectedCalls();
-                                                    CalcBetaAverage(call);
-                                                    CalcAlpha(call);
-                                                    allocCallWork0Found = true;
-                                                    allocCallWork1Found = true;
-                                                    allocCallWork2Found = true;
-                                                    break;
-                                                }
-                                            }
-                                            if(allocCallWork2Found)
-                                                break;
-                                        }
-                                    }
-                                }
-                                if (allocCallWork1Found)
-                                    break;
-                            }
-                            if (allocCallWork1Found)
-                                break;
-                        }
-                    }
-                }
-                if(allocCallWork0Found)
-                    break;
-            }
-            if(allocCallWork0Found)
-                break;
-        }
-
-        if(allocCallWork2Found == false) {
-            //Delete one route, recalculate Bit rate and try allocating with 2 routes
-            callsVec.pop_back();
-            double callBitRate = call->GetBitRate();
-            double beta = parameters->GetBeta();
-            double partialBitRate = ceil(
-                    ((1 - beta) * callBitRate) / (numSchProtRoutes - 2));
-            callWork0->SetBitRate(partialBitRate);
-            callWork1->SetBitRate(partialBitRate);
-            call->SetTranspSegments(callsVec);
-
-            //slot loop for callWork0
-            for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-                auxSlot0 = possibleSlots.at(s0);
-
-                for (unsigned int k = 0; k < numRoutes; k++) {
-                    callWork0->SetRoute(call->GetRoute(k));
-                    callWork0->SetModulation(FixedModulation);
-
-                    //getting protection routes to use in next loop (FOR)
-                    std::deque <std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-                    ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                                std::end(ProtRoutes), nullptr),std::end(ProtRoutes));
-                    unsigned int sizeProtRoutes = ProtRoutes.size();
-
-                    //calculate number of slots for current of call
-                    this->modulation->SetModulationParam(callWork0.get());
-
-                    if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                        continue;
-                    //checking if callWork0 number of slots are available in its route
-                    if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                           auxSlot0 + callWork0->GetNumberSlots() -1)) {
-                        callWork0->SetFirstSlot(auxSlot0);
-                        callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                        callWork0->SetCore(0);
-
-                        if (sizeProtRoutes >= 1) {  //if to skip case which it is no routes enough
-
-                            //slot loop for callWork1
-                            for (unsigned int s1 = 0; s1 < possibleSlots.size(); s1++) {
-                                auxSlot1 = possibleSlots.at(s1);
-                                for (unsigned int kd0 = 0; kd0 < sizeProtRoutes; kd0++) {
-                                    if (call->GetProtRoute(k,
-                                                           kd0)) {  //if to avoid null route pointer
-                                        callWork1->SetRoute(call->GetProtRoute(k, kd0));
-                                        callWork1->SetModulation(FixedModulation);
-
-                                        this->modulation->SetModulationParam(callWork1.get());
-
-                                        if (auxSlot1 + callWork1->GetNumberSlots() - 1 >= topNumSlots)
-                                            continue;
-                                        //checking if callWork1 slots are available in its route
-                                        if (this->resDevAlloc->CheckSlotsDisp(callWork1->GetRoute(), auxSlot1,
-                                                auxSlot1 + callWork1->GetNumberSlots() -1)) {
-                                            callWork1->SetFirstSlot(auxSlot1);
-                                            callWork1->SetLastSlot(auxSlot1 +callWork1->GetNumberSlots() - 1);
-                                            callWork1->SetCore(0);
-
-                                            call->SetRoute(call->GetRoute(k));
-                                            call->SetModulation(FixedModulation);
-                                            call->SetFirstSlot(callWork0->GetFirstSlot());
-                                            call->SetLastSlot(callWork0->GetLastSlot());
-                                            call->ClearTrialRoutes();
-                                            call->ClearTrialProtRoutes();
-                                            call->SetStatus(Accepted);
-                                            resDevAlloc->simulType->GetData()->SetProtectedCalls(); //increment proCalls counter
-                                            CalcBetaAverage(call);
-                                            CalcAlpha(call);
-                                            allocCallWork0Found = true;
-                                            allocCallWork1Found = true;
-                                            break;
-                                        }
-                                    }
-                                }
-                                if (allocCallWork1Found)
-                                    break;
-                            }
-                        }
-                    }
-                    if (allocCallWork0Found)
-                        break;
-                }
-                if (allocCallWork0Found)
-                    break;
-            }
-        }
-        /*if (allocCallWork0Found == false) {
-            //Delete one route and try allocating just 1 route (without protection)
-            callsVec.pop_back();
-            callWork0->SetBitRate(call->GetBitRate());
-            call->SetTranspSegments(callsVec);
-
-            for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-                auxSlot0 = possibleSlots.at(s0);
-
-                for (unsigned int k = 0; k < numRoutes; k++) {
-                    callWork0->SetRoute(call->GetRoute(k));
-                    callWork0->SetModulation(FixedModulation);
-
-                    //getting protection routes to use in next loop (FOR)
-                    std::deque <std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-                    ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                                                 std::end(ProtRoutes), nullptr),
-                                     std::end(ProtRoutes));
-                    unsigned int sizeProtRoutes = ProtRoutes.size();
-
-                    //calculate number of slots for current of call
-                    this->modulation->SetModulationParam(callWork0.get());
+        //try allocating with 3 routes
+        if(this->AllocateMultiPath(call, callsVec, possibleSlots))
+            return;
 
-                    if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                        continue;
-                    //checking if callWork0 number of slots are available in its route
-                    if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                                          auxSlot0 +
-                                                          callWork0->GetNumberSlots() - 1)) {
-                        callWork0->SetFirstSlot(auxSlot0);
-                        callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                        callWork0->SetCore(0);
+        //Delete one route, recalculate Bit rate and try allocating with 2 routes
+        callsVec.pop_back();
+        double callBitRate = call->GetBitRate();
+        double beta = parameters->GetBeta();
+        double partialBitRate = ceil(
+                ((1 - beta) * callBitRate) / (numSchProtRoutes - 2));
+        callWork0->SetBitRate(partialBitRate);
+        callWork1->SetBitRate(partialBitRate);
+        call->SetTranspSegments(callsVec);
 
-                        call->SetRoute(call->GetRoute(k));
-                        call->SetModulation(FixedModulation);
-                        call->SetFirstSlot(callWork0->GetFirstSlot());
-                        call->SetLastSlot(callWork0->GetLastSlot());
-                        call->ClearTrialRoutes();
-                        call->ClearTrialProtRoutes();
-                        call->SetStatus(Accepted);
-                        resDevAlloc->simulType->GetData()->SetNonProtectedCalls(); //increment proCalls counter
-                        CalcBetaAverage(call);
-                        CalcAlpha(call);
-                        allocCallWork0Found = true;
-                        break;
-                    }
-                }
-                if (allocCallWork0Found)
-                    break;
-            }
-        }*/
+        this->AllocateMultiPath(call, callsVec, possibleSlots);
     }
 
     if(numSchProtRoutes == 2) {
@@ -769,153 +531,12 @@ void PartitioningDedicatedPathProtection::SpecRoutingPDPP(CallDevices* call) {
 
         //seting 2 protection calls to allocation
         std::vector <std::shared_ptr<Call>> callsVec = call->GetTranspSegmentsVec();
-        std::shared_ptr <Call> callWork0 = callsVec.at(0);
-        std::shared_ptr <Call> callWork1 = callsVec.at(1);
 
-        //call->RepeatModulation();
-        unsigned int numRoutes = call->GetNumRoutes();
         call->SetCore(0);
-        bool allocCallWork0Found = false;
-        bool allocCallWork1Found = false;
-
-        const unsigned int topNumSlots = topology->GetNumSlots();
         std::vector<unsigned int> possibleSlots(0);
         possibleSlots = this->resDevAlloc->specAlloc->SpecAllocation();
-        unsigned int auxSlot0;
-        unsigned int auxSlot1;
-
-        //slot loop for callWork0
-        for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-            auxSlot0 = possibleSlots.at(s0);
-
-            for (unsigned int k = 0; k < numRoutes; k++) {
-                callWork0->SetRoute(call->GetRoute(k));
-                callWork0->SetModulation(FixedModulation);
-
-                //getting protection routes to use in next loop (FOR)
-                std::deque <std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-                ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                                             std::end(ProtRoutes), nullptr),
-                                 std::end(ProtRoutes));
-                unsigned int sizeProtRoutes = ProtRoutes.size();
-
-                //calculate number of slots for current of call
-                this->modulation->SetModulationParam(callWork0.get());
-
-                if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                    continue;
-                //checking if callWork0 number of slots are available in its route
-                if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                                      auxSlot0 +
-                                                      callWork0->GetNumberSlots() - 1)) {
-                    callWork0->SetFirstSlot(auxSlot0);
-                    callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                    callWork0->SetCore(0);
-
-                    if (sizeProtRoutes >= 1) {  //if to skip case which it is no routes enough
-
-                        //slot loop for callWork1
-                        for (unsigned int s1 = 0; s1 < possibleSlots.size(); s1++) {
-                            auxSlot1 = possibleSlots.at(s1);
-                            for (unsigned int kd0 = 0; kd0 < sizeProtRoutes; kd0++) {
-                                if (call->GetProtRoute(k, kd0)) {  //if to avoid null route pointer
-                                    callWork1->SetRoute(call->GetProtRoute(k, kd0));
-                                    callWork1->SetModulation(FixedModulation);
-
-                                    this->modulation->SetModulationParam(callWork1.get());
-
-                                    if (auxSlot1 + callWork1->GetNumberSlots() - 1 >=
-                                        topNumSlots)
-                                        continue;
-                                    //checking if callWork1 slots are available in its route
-                                    if (this->resDevAlloc->CheckSlotsDisp(
-                                            callWork1->GetRoute(), auxSlot1,
-                                            auxSlot1 + callWork1->GetNumberSlots() - 1)) {
-                                        callWork1->SetFirstSlot(auxSlot1);
-                                        callWork1->SetLastSlot(
-                                                auxSlot1 + callWork1->GetNumberSlots() -
-                                                1);
-                                        callWork1->SetCore(0);
-
-                                        call->SetRoute(call->GetRoute(k));
-                                        call->SetModulation(FixedModulation);
-                                        call->SetFirstSlot(callWork0->GetFirstSlot());
-                                        call->SetLastSlot(callWork0->GetLastSlot());
-                                        call->ClearTrialRoutes();
-                                        call->ClearTrialProtRoutes();
-                                        call->SetStatus(Accepted);
-                                        resDevAlloc->simulType->GetData()->SetProtectedCalls(); //increment proCalls counter
-                                        CalcBetaAverage(call);
-                                        CalcAlpha(call);
-                                        allocCallWork0Found = true;
-                                        allocCallWork1Found = true;
-                                        break;
-                                    }
-                                }
-                            }
-                            if (allocCallWork1Found)
-                                break;
-                        }
-                    }
-                }
-                if (allocCallWork0Found)
-                    break;
-            }
-            if (allocCallWork0Found)
-                break;
-        }
-
-        /*if (allocCallWork0Found == false) {
-            //Delete one route and try allocating just 1 route (without protection)
-            callsVec.pop_back();
-            callWork0->SetBitRate(call->GetBitRate());
-            call->SetTranspSegments(callsVec);
-
-            for (unsigned int s0 = 0; s0 < possibleSlots.size(); s0++) {
-                auxSlot0 = possibleSlots.at(s0);
 
-                for (unsigned int k = 0; k < numRoutes; k++) {
-                    callWork0->SetRoute(call->GetRoute(k));
-                    callWork0->SetModulation(FixedModulation);
-
-                    //getting protection routes to use in next loop (FOR)
-                    std::deque <std::shared_ptr<Route>> ProtRoutes = call->GetProtRoutes(k);
-                    ProtRoutes.erase(std::remove(std::begin(ProtRoutes),
-                                                 std::end(ProtRoutes), nullptr),
-                                     std::end(ProtRoutes));
-                    unsigned int sizeProtRoutes = ProtRoutes.size();
-
-                    //calculate number of slots for current of call
-                    this->modulation->SetModulationParam(callWork0.get());
-
-                    if (auxSlot0 + callWork0->GetNumberSlots() - 1 >= topNumSlots)
-                        continue;
-                    //checking if callWork0 number of slots are available in its route
-                    if (this->resDevAlloc->CheckSlotsDisp(callWork0->GetRoute(), auxSlot0,
-                                                          auxSlot0 +
-                                                          callWork0->GetNumberSlots() - 1)) {
-                        callWork0->SetFirstSlot(auxSlot0);
-                        callWork0->SetLastSlot(auxSlot0 + callWork0->GetNumberSlots() - 1);
-                        callWork0->SetCore(0);
-
-                        call->SetRoute(call->GetRoute(k));
-                        call->SetModulation(FixedModulation);
-                        call->SetFirstSlot(callWork0->GetFirstSlot());
-                        call->SetLastSlot(callWork0->GetLastSlot());
-                        call->ClearTrialRoutes();
-                        call->ClearTrialProtRoutes();
-                        call->SetStatus(Accepted);
-                        resDevAlloc->simulType->GetData()->SetNonProtectedCalls(); //increment proCalls counter
-                        CalcBetaAverage(call);
-                        CalcAlpha(call);
-                        allocCallWork0Found = true;
-                        break;
-                    }
-                }
-                if (allocCallWork0Found)
-                    break;
-            }
-        }*/
+        this->AllocateMultiPath(call, callsVec, possibleSlots);
     }
 }
 
@@ -11,6 +11,8 @@
  * Created on October 26, 2019, 9:31 AM
  */
 
+#include <boost/make_unique.hpp>
+
 #include "../../../include/ResourceAllocation/ProtectionSchemes/ProtectionScheme.h"
 #include "../../../include/Calls/Call.h"
 #include "../../../include/Data/Parameters.h"
@@ -22,7 +24,8 @@ ProtectionScheme::ProtectionScheme(ResourceDeviceAlloc* rsa)
 :resDevAlloc(rsa), resources(rsa->GetResources()), topology(rsa->GetTopology()),
 parameters(rsa->parameters), modulation(rsa->GetModulation()), 
 routing(rsa->routing.get()), protectionScheme(this->protectionScheme),
-numSchProtRoutes(3) {
+numSchProtRoutes(3),
+multiPathAlloc(boost::make_unique<MultiPathAlloc>(rsa)) {
     
 }
 
@@ -88,4 +91,74 @@ void ProtectionScheme::CalcAlpha(CallDevices *call) {
     resDevAlloc->simulType->GetData()->SetSumCallsAlpha(callAlpha);
 }
 
+bool ProtectionScheme::AllocateMultiPath(CallDevices* call, 
+const std::vector<std::shared_ptr<Call>>& pathCalls, 
+const std::vector<unsigned int>& possibleSlots) {
+    std::vector<unsigned int> numSlots;
+    MultiPathSolution solution;
+    Call* pathCall;
+    
+    for(auto& it: pathCalls)
+        numSlots.push_back(modulation->GetNumberSlots(FixedModulation, 
+                                                      it->GetBitRate()));
+    
+    if(!multiPathAlloc->FindFirst(call, numSlots, possibleSlots, solution)){
+        this->SetBlockedPaths(call, pathCalls);
+        return false;
+    }
+    
+    for(unsigned int a = 0; a < pathCalls.size(); a++){
+        pathCall = pathCalls.at(a).get();
+        
+        if(a == 0)
+            pathCall->SetRoute(call->GetRoute(solution.routeIndex));
+        else
+            pathCall->SetRoute(call->GetProtRoute(solution.routeIndex, 
+                               solution.protRouteIndexes.at(a - 1)));
+        pathCall->SetModulation(FixedModulation);
+        modulation->SetModulationParam(pathCall);
+        pathCall->SetFirstSlot(solution.firstSlots.at(a));
+        pathCall->SetLastSlot(solution.firstSlots.at(a) + 
+                              pathCall->GetNumberSlots() - 1);
+        pathCall->SetCore(0);
+    }
+    
+    call->SetRoute(call->GetRoute(solution.routeIndex));
+    call->SetModulation(FixedModulation);
+    call->SetFirstSlot(pathCalls.front()->GetFirstSlot());
+    call->SetLastSlot(pathCalls.front()->GetLastSlot());
+    call->ClearTrialRoutes();
+    call->ClearTrialProtRoutes();
+    call->SetStatus(Accepted);
+    //increment proCalls counter
+    resDevAlloc->simulType->GetData()->SetProtectedCalls();
+    CalcBetaAverage(call);
+    CalcAlpha(call);
+    
+    return true;
+}
 
+void ProtectionScheme::SetBlockedPaths(CallDevices* call, 
+const std::vector<std::shared_ptr<Call>>& pathCalls) {
+    unsigned int k = call->GetNumRoutes() - 1;
+    std::shared_ptr<Route> route;
+    
+    if(call->GetNumRoutes() == 0)
+        return;
+    
+    for(unsigned int a = 0; a < pathCalls.size(); a++){
+        
+        if(a == 0)
+            route = call->GetRoute(k);
+        else if(a - 1 < call->GetProtRoutes(k).size())
+            route = call->GetProtRoute(k, a - 1);
+        else
+            route = nullptr;
+        
+        if(!route)
+            continue;
+        pathCalls.at(a)->SetRoute(route);
+        pathCalls.at(a)->SetModulation(FixedModulation);
+        modulation->SetModulationParam(pathCalls.at(a).get());
+    }
+}
@@ -39,7 +39,7 @@ unsigned subRouteIndex) {
                                                         subRouteIndex);
     unsigned int numSlots = resDevAlloc->resources->GetNumberSlots(call, 
     routeIndex, subRouteIndex);
-    std::vector<std::shared_ptr<Route>> vecRoutes = 
+    const std::vector<std::shared_ptr<Route>>& vecRoutes = 
     resDevAlloc->resources->GetRoutesTranspSegments(call, routeIndex, 
     subRouteIndex);
     std::shared_ptr<Route> auxRoute;
@@ -24,7 +24,7 @@ RegeneratorAssignment::~RegeneratorAssignment() {
 
 void RegeneratorAssignment::OrderRegenerationOptions(CallDevices* call, 
 std::vector<std::tuple<unsigned, unsigned> >& vec) {
-    std::vector<std::vector<unsigned>> vecNumReg = 
+    const std::vector<std::vector<unsigned>>& vecNumReg = 
     resDevAlloc->resources->GetNumberRegSet(call);
     std::vector<std::vector<double>> vecCosts(0);
     
@@ -83,23 +83,22 @@ unsigned routeIndex, unsigned subRouteIndex) {
 unsigned int RegeneratorAssignment::GetN(CallDevices* call) {
     unsigned int numSlots;
     
-    numSlots = resDevAlloc->modulation->GetNumberSlots(FirstModulation,
-    call->GetBitRate());
+    numSlots = resDevAlloc->modulation->GetDemandParam(FirstModulation,
+    call->GetBitRate()).numSlots;
     
     return numSlots;
 }
 
 bool RegeneratorAssignment::CheckSpectrumAndOSNR(const double bitRate, 
 Route* route, TypeModulation modulation) {
-    double osnrThreshold = resDevAlloc->modulation->GetOSNRQAM(modulation, 
-                                                               bitRate);
-    unsigned numSlots = resDevAlloc->modulation->GetNumberSlots(modulation,
-                                                                bitRate);
+    DemandParam demand = resDevAlloc->modulation->GetDemandParam(modulation,
+                                                                 bitRate);
     
-    if(!resDevAlloc->ResourceAlloc::CheckOSNR(route, osnrThreshold))
+    if(!resDevAlloc->ResourceAlloc::CheckOSNR(route, demand.osnrTh))
         return false;
     
-    if(!resDevAlloc->ResourceAlloc::CheckBlockSlotsDisp(route, numSlots))
+    if(!resDevAlloc->ResourceAlloc::CheckBlockSlotsDisp(route, 
+                                                        demand.numSlots))
         return false;
     
     return true;
@@ -128,19 +127,16 @@ Route* route) {
     std::vector<TypeModulation> auxVecModulations = 
     Modulation::GetModulationFormats();
     TypeModulation auxMod;
-    double osnrThreshold;
-    unsigned numSlots;
+    DemandParam demand;
     
     for(unsigned a = 0; a < auxVecModulations.size(); a++){
         auxMod = auxVecModulations.at(a);
         
         if(auxMod != InvalidModulation){
-            osnrThreshold = resDevAlloc->modulation->GetOSNRQAM(auxMod, 
-                                                                bitRate);
-            numSlots = resDevAlloc->modulation->GetNumberSlots(auxMod, bitRate);
+            demand = resDevAlloc->modulation->GetDemandParam(auxMod, bitRate);
 
-            if(resDevAlloc->ResourceAlloc::CheckOSNR(route, osnrThreshold) && 
-            resDevAlloc->CheckBlockSlotsDisp(route, numSlots)){
+            if(resDevAlloc->ResourceAlloc::CheckOSNR(route, demand.osnrTh) && 
+            resDevAlloc->CheckBlockSlotsDisp(route, demand.numSlots)){
                 return auxMod;
             }
         }
@@ -50,10 +50,10 @@ unsigned subRouteIndex) {
     double auxNumSlots;
     double totalFreeReg;
     double numUsedReg;
-    std::vector<std::shared_ptr<Route>> vecSubRoutes = 
+    const std::vector<std::shared_ptr<Route>>& vecSubRoutes = 
     resDevAlloc->resources->GetRoutesTranspSegments(call, routeIndex, 
                                                     subRouteIndex);
-    std::vector<unsigned> vecNumSlots = 
+    const std::vector<unsigned>& vecNumSlots = 
     resDevAlloc->resources->GetNumSlotsPerTranspSegments(call, routeIndex,
                                                          subRouteIndex);
     
@@ -11,6 +11,11 @@
  * Created on November 27, 2018, 8:33 PM
  */
 
+#include <algorithm>
+#include <thread>
+#include <atomic>
+#include <unordered_set>
+
 #include "../../include/ResourceAllocation/ResourceAlloc.h"
 #include "../../include/SimulationType/SimulationType.h"
 #include "../../include/Structure/Structures.h"
@@ -20,6 +25,7 @@
 #include "../../include/ResourceAllocation/CSA.h"
 #include "../../include/ResourceAllocation/Modulation.h"
 #include "../../include/ResourceAllocation/Resources.h"
+#include "../../include/ResourceAllocation/ResourcesCache.h"
 #include "../../include/ResourceAllocation/Signal.h"
 #include "../../include/Data/Parameters.h"
 #include "../../include/Data/InputOutput.h"
@@ -28,11 +34,13 @@
 #include "../../include/Calls/Call.h"
 #include "../../include/Calls/Traffic.h"
 #include "../../include/Calls/EventGenerator.h"
+#include "../../include/GeneralClasses/RandomStreams.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 ResourceAlloc::ResourceAlloc(SimulationType *simulType)
 :topology(nullptr), traffic(nullptr), options(nullptr), simulType(simulType),
 parameters(nullptr), routing(nullptr), specAlloc(nullptr), modulation(nullptr),
-resources(nullptr), route(nullptr) {
+resources(nullptr), resourcesCache(nullptr), route(nullptr) {
     
 }
 
@@ -41,6 +49,7 @@ ResourceAlloc::~ResourceAlloc() {
     specAlloc.reset();
     modulation.reset();
     resources.reset();
+    resourcesCache.reset();
 }
 
 void ResourceAlloc::Load() {
@@ -58,6 +67,9 @@ void ResourceAlloc::Load() {
     
     resources = std::make_shared<Resources>(this, modulation.get());
     
+    if(options->GetCacheOption() == CacheEnabled)
+        resourcesCache = std::make_shared<ResourcesCache>(this);
+    
     resourAllocOption = this->options->GetResourAllocOption();
     phyLayerOption = this->options->GetPhyLayerOption();
     
@@ -68,20 +80,37 @@ void ResourceAlloc::Load() {
 }
 
 void ResourceAlloc::AdditionalSettings() {
+    this->modulation->CreateDemandTable(this->traffic->GetVecTraffic());
     
     if(this->IsOfflineRouting()){
-        this->RoutingOffline();
-        this->UpdateRoutesCosts();
-        this->SetNumSlotsTraffic();
+        
+        if(this->resourcesCache && this->resourcesCache->IsCacheableRouting()){
+            //The slots of the traffic are taken before the offline modulation
+            //tables are loaded, as they are when the tables are computed.
+            this->SetNumSlotsTraffic();
+            this->resourcesCache->Load();
+        }
+        
+        if(!this->IsResourcesCacheLoaded()){
+            this->RoutingOffline();
+            this->UpdateRoutesCosts();
+            this->SetNumSlotsTraffic();
+        }
         
         if(this->CheckInterRouting()){
-            this->SetInterferingRoutes();
+            
+            if(!this->IsResourcesCacheLoaded())
+                this->SetInterferingRoutes();
             this->SetNumInterRoutesToCheck();
         }
         
         if(options->GetResourAllocOption() == ResourAllocRMSA){
-            this->resources->CreateOfflineModulation();
-            this->resources->Save(); //Retirar depois (Markov)
+            
+            if(!this->IsResourcesCacheLoaded())
+                this->resources->CreateOfflineModulation();
+            
+            if(!this->simulType->IsCopy())
+                this->resources->Save(); //Retirar depois (Markov)
         }
     }
     this->CreateRsaOrder();
@@ -153,7 +182,8 @@ void ResourceAlloc::RoutingSpecRandom(Call* call) {
     //shuffle the k routes
     std::deque<std::shared_ptr<Route>> auxTrialRoutes;
     auxTrialRoutes = call->GetTrialRoutes();    
-    std::shuffle(auxTrialRoutes.begin(), auxTrialRoutes.end(), Def::randomEngine);
+    std::shuffle(auxTrialRoutes.begin(), auxTrialRoutes.end(), 
+                 simulType->GetRandomStreams()->GetEngine(StreamRouting));
     /*for(unsigned int index = 0; index < rand() % 2 + 1; index++){
         std::shuffle(std::begin(auxTrialRoutes), std::end(auxTrialRoutes), 
         std::default_random_engine());
@@ -338,19 +368,15 @@ bool ResourceAlloc::CheckSlotDisp(Route* route, SlotIndex slot, SlotState type)
 bool ResourceAlloc::CheckSlotsDisp(Route* route, SlotIndex firstSlot, 
 SlotIndex lastSlot) const {
     
-    for(unsigned int a = firstSlot; a <= lastSlot; a++){
-        if(!this->CheckSlotDisp(route, a))
-            return false;
-    }
-    
-    return true;
+    return this->CheckSlotsDisp(route, firstSlot, lastSlot, occupied);
 }
 
 bool ResourceAlloc::CheckSlotsDisp(Route* route, SlotIndex firstSlot,
                                    SlotIndex lastSlot, SlotState type) const {
-
-    for(unsigned int a = firstSlot; a <= lastSlot; a++){
-        if(!this->CheckSlotDisp(route, a, type))
+    unsigned int numHops = route->GetNumHops();
+    
+    for(unsigned int a = 0; a < numHops; a++){
+        if(!route->GetLink(a)->IsSlotsFree(0, firstSlot, lastSlot, type))
             return false;
     }
 
@@ -359,64 +385,27 @@ bool ResourceAlloc::CheckSlotsDisp(Route* route, SlotIndex firstSlot,
 
 bool ResourceAlloc::CheckBlockSlotsDisp(Route* route, unsigned int numSlots) 
 const {
-    unsigned int numContiguousSlots = 0;
-    unsigned int totalNumSlots = topology->GetNumSlots();
-
-    for(unsigned int s = 0; s < totalNumSlots; s++){
-        
-        if(this->CheckSlotDisp(route, s))
-            numContiguousSlots++;
-        else
-            numContiguousSlots = 0;
-        if(numContiguousSlots == numSlots)
-            return true;
-    }
-    return false;
+    
+    return this->GetDispMask(route, 0).FindFirstBlock(numSlots) != 
+           Def::Max_UnInt;
 }
 
 bool ResourceAlloc::CheckSlotsDispCore(Route* route, SlotIndex firstSlot, 
 SlotIndex lastSlot, CoreIndex core) const {
-    bool flag = false;
-    Link* link = route->GetLink(0);
-    
-    //Check the availability of the set of slots in the core on the first hop
-    for(unsigned int s = firstSlot; s <= lastSlot; s++){
-        // is link c->c+1 busy in slot s?
-        if(link->IsSlotOccupied(core, s)){
-            flag = true;
-            break;
-        }
-        // found the core in the first link
-        if(s == lastSlot)
-            break;
-    }
-    if(flag)
-        return false;
+    unsigned int numHops = route->GetNumHops();
     
-    //Check the availability of the set of slots in the core on the rest of the 
-    //route
-    for(unsigned int c = 1; c < route->GetNumHops(); c++){
-        link = route->GetLink(c);
-        
-        for(unsigned int s = firstSlot; s <= lastSlot; s++){
-            if(link->IsSlotOccupied(core, s))
-                return false;
-        }
+    for(unsigned int c = 0; c < numHops; c++){
+        if(!route->GetLink(c)->IsSlotsFree(core, firstSlot, lastSlot, 
+                                           occupied))
+            return false;
     }
     return true;
 }
 
 bool ResourceAlloc::CheckOSNR(const Route* route, double OSNRth) {
-    Link* link;
-    unsigned int numHops = route->GetNumHops();
-    std::shared_ptr<Signal> signal = std::make_shared<Signal>();
+    PROFILE_SCOPE(PhaseOSNR);
     
-    for(unsigned int a = 0; a < numHops; a++){
-        link = route->GetLink(a);
-        link->CalcSignal(signal.get());
-    }
-    
-    if(signal->GetOSNR() > OSNRth)
+    if(route->GetOSNR() > OSNRth)
         return true;
     return false;
 }
@@ -433,6 +422,21 @@ Resources* ResourceAlloc::GetResources() const {
     return resources.get();
 }
 
+ResourcesCache* ResourceAlloc::GetResourcesCache() const {
+    return resourcesCache.get();
+}
+
+bool ResourceAlloc::IsResourcesCacheLoaded() const {
+    return this->resourcesCache && this->resourcesCache->IsLoaded();
+}
+
+void ResourceAlloc::SaveResourcesCache() {
+    
+    if(this->resourcesCache && this->resourcesCache->IsCacheableRouting() &&
+    this->IsOfflineRouting() && !this->simulType->IsCopy())
+        this->resourcesCache->Save();
+}
+
 Modulation* ResourceAlloc::GetModulation() const {
     return modulation.get();
 }
@@ -583,6 +587,7 @@ void ResourceAlloc::EnableRouteLinks(Route* route) {
 
 
 double ResourceAlloc::CalcNetworkFragmentation() const {
+    PROFILE_SCOPE(PhaseFragmentation);
     double totalFrag = 0.0;
     unsigned int numNodes = topology->GetNumNodes();
     Link* link;
@@ -617,93 +622,48 @@ double ResourceAlloc::CalcLinkFragmentation(Link* link) const {
 }
 
 double ResourceAlloc::CalcLinkFragmentationFR(Link* link) const {
-    std::vector<SlotState> vecDisp = link->GetVecDisp();
-    unsigned int numFreeSlots = link->GetNumberFreeSlots();
-    double a = 0.0;
+    double a = (double) link->GetNumSimultAloc();
     double b = 1.0;
     
-    for(auto it: resources->numSlotsTraffic){
-        a += this->CalcNumSimultAloc(it, vecDisp);
-    }
-    
-    if(numFreeSlots != 0 && a != 0.0){
-        b = 0.0;
-        vecDisp.assign(vecDisp.size(), occupied);
-        
-        for(auto it: vecDisp){
-            it = free;
-            numFreeSlots--;
-
-            if(numFreeSlots == 0)
-                break;
-        }
-    
-        for(auto it: resources->numSlotsTraffic){
-            b += this->CalcNumSimultAloc(it, vecDisp);
-        }
-    }
+    //The reference is the number of allocations if all free slots of the
+    //link were contiguous.
+    if(a != 0.0)
+        b = (double) topology->GetNumSimultAloc(link->GetNumberFreeSlots());
     
     return (1 - (a/b));
 }
 
 double ResourceAlloc::CalcLinkFragmentationEF(Link* link) const {
-    std::vector<SlotState> vecDisp = link->GetVecDisp();
-    std::vector<unsigned int> freeSlotsBlocks = 
-    this->GetBlocksFreeSlots(1, vecDisp);
-    double a = 0.0;
+    double a = (double) link->GetLargestFreeBlock();
     double b = 1.0;
     
-    if(!freeSlotsBlocks.empty()){
-        a = (double) *std::max_element(freeSlotsBlocks.begin(), 
-                                       freeSlotsBlocks.end());
-    }
-    
-    if(a != 0.0){
-        b = (double) std::accumulate(freeSlotsBlocks.begin(),
-                                     freeSlotsBlocks.end(), 0);
-    }
+    if(a != 0.0)
+        b = (double) link->GetNumberFreeSlots();
     
     return 1 - (a/b);
 }
 
 double ResourceAlloc::CalcLinkFragmentationABP(Link* link) const {
-    std::vector<SlotState> vecDisp = link->GetVecDisp();
-    unsigned int numFreeSlots = link->GetNumberFreeSlots();
-    std::vector<unsigned int> freeSlotsBlocks = 
-    this->GetBlocksFreeSlots(1, vecDisp);
-    double a = 0.0;
+    double a = (double) link->GetNumSimultAloc();
     double b = 1.0;
-    unsigned int aux = 0;
-    
-    for(auto block: freeSlotsBlocks){
-        for(auto traf: resources->numSlotsTraffic){
-            aux = block / traf;
-            a += (double) aux;
-        }
-    }
     
-    if(a != 0.0){
-        b = 0.0;
-        
-        for(auto traf: resources->numSlotsTraffic){
-            aux = numFreeSlots / traf;
-            b += (double) aux;
-        }
-    }
+    if(a != 0.0)
+        b = (double) topology->GetNumSimultAloc(link->GetNumberFreeSlots());
     
     return 1 - (a/b);
 }
 
-std::vector<std::shared_ptr<Route>> ResourceAlloc::GetInterRoutes(int ori, 
-int des, int pos) {
+const std::vector<std::shared_ptr<Route>>& ResourceAlloc::GetInterRoutes(
+int ori, int des, int pos) const {
     return this->resources->interRoutes.at(ori*(this->topology->GetNumNodes()) 
     + des).at(pos);
 }
 
-std::vector<std::shared_ptr<Route>> ResourceAlloc::GetInterRoutes(
-unsigned int orNode, unsigned int deNode, Route* route){
-    std::vector<std::shared_ptr<Route>> routes = resources->GetRoutes(orNode, 
-                                                                      deNode);
+const std::vector<std::shared_ptr<Route>>& ResourceAlloc::GetInterRoutes(
+unsigned int orNode, unsigned int deNode, Route* route) const {
+    static const std::vector<std::shared_ptr<Route>> noRoutes(0);
+    const std::vector<std::shared_ptr<Route>>& routes = 
+    resources->GetRoutes(orNode, deNode);
     unsigned int numRoutes = routes.size();
     
     for(unsigned int pos = 0; pos < numRoutes; pos++){
@@ -712,30 +672,30 @@ unsigned int orNode, unsigned int deNode, Route* route){
             return this->GetInterRoutes(orNode, deNode, pos);
     }
     
-    routes.clear();
-    return routes;
+    return noRoutes;
 }
 
 void ResourceAlloc::SetInterferingRoutes() {
-    std::shared_ptr<Route> routeAux, interRoute;
-    Link *auxLink, *interLink;
     unsigned int numNodes = this->topology->GetNumNodes();
-    unsigned int auxIndex;
-    bool addroute = true;
-    
-    this->resources->interRoutes.resize(this->resources->allRoutes.size());
-    
-    for(unsigned int orN = 0; orN < numNodes; orN++){
-        for(unsigned int deN = 0; deN < numNodes; deN++){
-            if(orN == deN)
-                continue;
-            auxIndex = (orN * numNodes) + deN;
-            this->resources->interRoutes.at(auxIndex).resize(
-            this->resources->allRoutes.at(auxIndex).size());
-        }
-    }
-    
-    for(unsigned int a = 0; a < this->resources->allRoutes.size(); a++){
+    unsigned int numPairs = this->resources->allRoutes.size();
+    unsigned int numThreads = std::max(1U, std::min(numPairs, 
+    std::thread::hardware_concurrency()));
+    std::vector<std::vector<std::shared_ptr<Route>>> linkRoutes(
+    numNodes * numNodes);
+    std::vector<std::thread> threads;
+    std::atomic<unsigned int> nextPair(0);
+    std::shared_ptr<Route> routeAux;
+    Link* auxLink;
+    
+    this->resources->interRoutes.assign(numPairs, 
+    std::vector<std::vector<std::shared_ptr<Route>>>(0));
+    
+    //Inverted index with the routes that use each link, in the same order
+    //of the container of all routes.
+    for(unsigned int a = 0; a < numPairs; a++){
+        this->resources->interRoutes.at(a).resize(
+        this->resources->allRoutes.at(a).size());
+        
         for(unsigned int b = 0; b < this->resources->allRoutes.at(a).size(); 
         b++){
             routeAux = this->resources->allRoutes.at(a).at(b);
@@ -745,57 +705,62 @@ void ResourceAlloc::SetInterferingRoutes() {
             
             for(unsigned int c = 0; c < routeAux->GetNumHops(); c++){
                 auxLink = routeAux->GetLink(c);
-                
-                for(unsigned int d = 0; d < this->resources->allRoutes.size(); 
-                d++){
-                    for(unsigned int e = 0; e < this->resources->allRoutes.
-                    at(d).size(); e++){
-                        interRoute = this->resources->allRoutes.at(d).at(e);
-                        
-                        if(interRoute == nullptr || interRoute == routeAux)
-                            continue;
-                        
-                        for(unsigned int f = 0; f < interRoute->GetNumHops();
-                        f++){
-                            interLink = interRoute->GetLink(f);
-                            
-                            if(auxLink == interLink){
-                                
-                                for(unsigned int g = 0; g < this->resources->
-                                interRoutes.at(a).at(b).size(); g++){
-                                    
-                                    if(this->resources->interRoutes.at(a).at(b).
-                                    at(g) == interRoute){
-                                        addroute = false;
-                                        break;
-                                    }
-                                }
-                                if(addroute){
-                                    this->resources->interRoutes.at(a).at(b).
-                                    push_back(interRoute);
-                                }
-                                addroute = true;
-                                break;
-                            }
-                        }
-                    }
-                }
+                linkRoutes.at(auxLink->GetOrigimNode() * numNodes + 
+                auxLink->GetDestinationNode()).push_back(routeAux);
             }
         }
     }
     
-    for(unsigned int a = 0; a < this->resources->interRoutes.size(); a++){
-        for(unsigned int b = 0; b < this->resources->interRoutes.at(a).size(); 
-        b++){
-            std::sort(this->resources->interRoutes.at(a).at(b).begin(), 
-                      this->resources->interRoutes.at(a).at(b).end(), 
-                      RouteCompare());
+    for(unsigned int t = 0; t < numThreads; t++){
+        threads.push_back(std::thread([&](){
+            std::unordered_set<Route*> addedRoutes;
+            unsigned int a;
+            
+            while((a = nextPair++) < numPairs)
+                this->SetInterferingRoutes(a, linkRoutes, addedRoutes);
+        }));
+    }
+    
+    for(auto& it: threads)
+        it.join();
+}
+
+void ResourceAlloc::SetInterferingRoutes(unsigned int pairIndex, 
+const std::vector<std::vector<std::shared_ptr<Route>>>& linkRoutes, 
+std::unordered_set<Route*>& addedRoutes) {
+    unsigned int numNodes = this->topology->GetNumNodes();
+    std::vector<std::shared_ptr<Route>>& pairRoutes = 
+    this->resources->allRoutes.at(pairIndex);
+    Route* routeAux;
+    Link* auxLink;
+    
+    for(unsigned int b = 0; b < pairRoutes.size(); b++){
+        std::vector<std::shared_ptr<Route>>& routeInter = 
+        this->resources->interRoutes.at(pairIndex).at(b);
+        routeAux = pairRoutes.at(b).get();
+        
+        if(routeAux == nullptr)
+            continue;
+        addedRoutes.clear();
+        
+        for(unsigned int c = 0; c < routeAux->GetNumHops(); c++){
+            auxLink = routeAux->GetLink(c);
+            
+            for(auto& interRoute: linkRoutes.at(auxLink->GetOrigimNode() * 
+            numNodes + auxLink->GetDestinationNode())){
+                
+                if(interRoute.get() != routeAux && 
+                addedRoutes.insert(interRoute.get()).second)
+                    routeInter.push_back(interRoute);
+            }
         }
+        
+        std::sort(routeInter.begin(), routeInter.end(), RouteCompare());
     }
 }
 
-std::vector<std::vector<unsigned int> > 
-ResourceAlloc::GetNumInterRoutesToCheck() {
+const std::vector<std::vector<unsigned int> >& 
+ResourceAlloc::GetNumInterRoutesToCheck() const {
     return resources->numInterRoutesToCheck;
 }
 
@@ -804,7 +769,7 @@ unsigned int deNode, Route* route) {
     unsigned int numNodes = this->topology->GetNumNodes();
     unsigned int vecIndex = orNode*numNodes + deNode;
     unsigned int numRoutes = 0;
-    std::vector<unsigned int> vecNumInterRoutes = 
+    const std::vector<unsigned int>& vecNumInterRoutes = 
     this->resources->numInterRoutesToCheck.at(vecIndex);
     
     for(unsigned int pos = 0; pos < vecNumInterRoutes.size(); pos++){
@@ -844,27 +809,58 @@ std::vector<std::vector<unsigned int>> numInterRoutesToCheck) {
     this->resources->numInterRoutesToCheck = numInterRoutesToCheck;
 }
 
-std::vector<unsigned int> ResourceAlloc::GetNumSlotsTraffic() const {
+const std::vector<unsigned int>& ResourceAlloc::GetNumSlotsTraffic() const {
     return resources->numSlotsTraffic;
 }
 
 void ResourceAlloc::SetNumSlotsTraffic() {
     this->resources->numSlotsTraffic = this->modulation->GetPossibleSlots(
     this->traffic->GetVecTraffic());
+    this->topology->SetNumSlotsTraffic(this->resources->numSlotsTraffic);
 }
 
 std::vector<SlotState> ResourceAlloc::GetDispVector(Route* route) const {
     unsigned int topNumSlots = topology->GetNumSlots();
-    std::vector<SlotState> vecDisp(topNumSlots, free);
+    std::vector<SlotState> vecDisp(topNumSlots, occupied);
+    SlotMask dispMask = this->GetDispMask(route, 0);
     
-    for(SlotIndex a = 0; a < topNumSlots; a++){
-        if(!this->CheckSlotDisp(route, a))
-            vecDisp.at(a) = occupied;
-    }
+    for(SlotIndex a = dispMask.FindNext(0); a < topNumSlots; 
+    a = dispMask.FindNext(a + 1))
+        vecDisp[a] = free;
     
     return vecDisp;
 }
 
+SlotMask ResourceAlloc::GetDispMask(Route* route, CoreIndex core) const {
+    unsigned int numHops = route->GetNumHops();
+    SlotMask dispMask(route->GetLink(0)->GetFreeSlots(core));
+    
+    for(unsigned int a = 1; a < numHops; a++)
+        dispMask &= route->GetLink(a)->GetFreeSlots(core);
+    
+    return dispMask;
+}
+
+std::vector<SlotMask> ResourceAlloc::GetDispMasks(Route* route) const {
+    unsigned int numHops = route->GetNumHops();
+    unsigned int numCores = this->topology->GetNumCores();
+    Link* link = route->GetLink(0);
+    std::vector<SlotMask> dispMasks;
+    dispMasks.reserve(numCores);
+    
+    for(CoreIndex core = 0; core < numCores; core++)
+        dispMasks.push_back(link->GetFreeSlots(core));
+    
+    for(unsigned int a = 1; a < numHops; a++){
+        link = route->GetLink(a);
+        
+        for(CoreIndex core = 0; core < numCores; core++)
+            dispMasks[core] &= link->GetFreeSlots(core);
+    }
+    
+    return dispMasks;
+}
+
 unsigned int ResourceAlloc::CalcNumFormAloc(unsigned int callSize, 
 std::vector<SlotState>& dispVec) const {
     std::vector<unsigned int> freeSlotsBlocks = 
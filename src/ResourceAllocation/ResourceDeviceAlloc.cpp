@@ -53,7 +53,9 @@ void ResourceDeviceAlloc::AdditionalSettings() {
         if(this->options->GetRegenerationOption() != RegenerationDisabled){
             assert(options->GetPhyLayerOption() == PhyLayerEnabled);
             assert(options->GetResourAllocOption() == ResourAllocRMSA);
-            this->resources->CreateRegenerationResources();
+            
+            if(!this->IsResourcesCacheLoaded())
+                this->resources->CreateRegenerationResources();
         }
     
         // Put functions to create the offline
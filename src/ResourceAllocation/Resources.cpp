@@ -150,18 +150,18 @@ void Resources::ClearRoutes(unsigned int orN, unsigned int deN) {
     allRoutes.at(orN*resourceAlloc->GetTopology()->GetNumNodes() + deN).clear();
 }
 
-std::vector<std::shared_ptr<Route> > Resources::GetRoutes(unsigned int orN, 
-unsigned int deN) {
+const std::vector<std::shared_ptr<Route> >& Resources::GetRoutes(
+unsigned int orN, unsigned int deN) const {
     return allRoutes.at(orN*resourceAlloc->GetTopology()->GetNumNodes() + deN);
 }
 
-std::vector<std::vector<std::shared_ptr<Route> > > Resources::GetRoutes() 
-const {
+const std::vector<std::vector<std::shared_ptr<Route> > >& 
+Resources::GetRoutes() const {
     return allRoutes;
 }
 
-std::vector<std::shared_ptr<Route> > Resources::GetProtRoutes(unsigned int orN, 
-    unsigned int deN, unsigned int routeInd) {
+const std::vector<std::shared_ptr<Route> >& Resources::GetProtRoutes(
+unsigned int orN, unsigned int deN, unsigned int routeInd) const {
     return protectionAllRoutes.at(orN*resourceAlloc->GetTopology()->GetNumNodes()
     + deN).at(routeInd);
 }
@@ -188,7 +188,8 @@ std::vector<TypeModulation> Resources::GetOfflineModulationFormats(Call* call) {
     return vecMod;
 }
 
-std::vector<std::vector<unsigned> > Resources::GetNumberRegSet(Call* call) {
+const std::vector<std::vector<unsigned> >& Resources::GetNumberRegSet(
+Call* call) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
@@ -197,7 +198,8 @@ std::vector<std::vector<unsigned> > Resources::GetNumberRegSet(Call* call) {
     return numReg.at(trIndex).at(nodeIndex);
 }
 
-std::vector<std::vector<unsigned> > Resources::GetNumberSlotsSet(Call* call) {
+const std::vector<std::vector<unsigned> >& Resources::GetNumberSlotsSet(
+Call* call) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
@@ -226,8 +228,8 @@ unsigned subRouteIndex) {
     return numSlots.at(trIndex).at(nodeIndex).at(routeIndex).at(subRouteIndex);
 }
 
-std::vector<unsigned> Resources::GetNumSlotsPerTranspSegments(Call* call, 
-unsigned routeIndex, unsigned subRouteIndex) {
+const std::vector<unsigned>& Resources::GetNumSlotsPerTranspSegments(
+Call* call, unsigned routeIndex, unsigned subRouteIndex) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
@@ -237,8 +239,8 @@ unsigned routeIndex, unsigned subRouteIndex) {
                               .at(subRouteIndex);
 }
 
-std::vector<std::shared_ptr<Route>> Resources::GetRoutesTranspSegments(Call* call, 
-unsigned int subRouteIndex) {
+const std::vector<std::shared_ptr<Route>>& Resources::GetRoutesTranspSegments(
+Call* call, unsigned int subRouteIndex) {
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
     GetTopology()->GetNumNodes()) + call->GetDeNode()->GetNodeId();
     unsigned routeIndex = this->GetRouteIndex(call->GetRoute(), call->
@@ -247,15 +249,16 @@ unsigned int subRouteIndex) {
     return subRoutes.at(nodeIndex).at(routeIndex).at(subRouteIndex);
 }
 
-std::vector<std::shared_ptr<Route> > Resources::GetRoutesTranspSegments(Call* call, 
-unsigned int routeIndex, unsigned int subRouteIndex) {
+const std::vector<std::shared_ptr<Route> >& 
+Resources::GetRoutesTranspSegments(Call* call, unsigned int routeIndex, 
+unsigned int subRouteIndex) {
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
     GetTopology()->GetNumNodes()) + call->GetDeNode()->GetNodeId();
     
     return subRoutes.at(nodeIndex).at(routeIndex).at(subRouteIndex);
 }
 
-std::vector<std::vector<std::vector<std::shared_ptr<Route> > > >
+const std::vector<std::vector<std::vector<std::shared_ptr<Route> > > >&
 Resources::GetRoutesTranspSegments(Call* call) {
     unsigned int nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
     GetTopology()->GetNumNodes()) + call->GetDeNode()->GetNodeId();
@@ -263,8 +266,8 @@ Resources::GetRoutesTranspSegments(Call* call) {
     return subRoutes.at(nodeIndex);
 }
 
-std::vector<TypeModulation> Resources::GetTranspSegmentsModulation(Call* call, 
-unsigned int subRouteIndex) {
+const std::vector<TypeModulation>& Resources::GetTranspSegmentsModulation(
+Call* call, unsigned int subRouteIndex) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
     unsigned nodeIndex = (call->GetOrNode()->GetNodeId() * resourceAlloc->
@@ -276,7 +279,7 @@ unsigned int subRouteIndex) {
                               .at(subRouteIndex);
 }
 
-std::vector<std::vector<std::vector<TypeModulation> > > 
+const std::vector<std::vector<std::vector<TypeModulation> > >& 
 Resources::GetSetsTranpSegmentsModulation(Call* call) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
@@ -286,7 +289,7 @@ Resources::GetSetsTranpSegmentsModulation(Call* call) {
     return subRoutesModulation.at(trIndex).at(nodeIndex);
 }
 
-std::vector<std::vector<std::vector<unsigned int> > > 
+const std::vector<std::vector<std::vector<unsigned int> > >& 
 Resources::GetSetsTranspSegmentsNumSlots(Call* call) {
     unsigned trIndex = resourceAlloc->GetTraffic()->GetTrafficIndex(call->
                        GetBitRate());
@@ -0,0 +1,362 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   ResourcesCache.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:10 PM
+ */
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <iomanip>
+
+#include "../../include/ResourceAllocation/ResourcesCache.h"
+#include "../../include/ResourceAllocation/ResourceAlloc.h"
+#include "../../include/ResourceAllocation/Resources.h"
+#include "../../include/ResourceAllocation/Route.h"
+#include "../../include/SimulationType/SimulationType.h"
+#include "../../include/Structure/Topology.h"
+#include "../../include/Calls/Traffic.h"
+#include "../../include/Data/InputOutput.h"
+#include "../../include/Data/Parameters.h"
+#include "../../include/Data/Options.h"
+
+const std::uint32_t ResourcesCache::version = 1;
+
+//File signature, followed by the format version and the key.
+static const char cacheSignature[8] = {'O', 'N', 'S', 'C', 'A', 'C', 'H', 'E'};
+
+//Tags of the routes written in the file.
+enum CacheRouteTag : std::uint32_t {
+    CacheRouteNull,
+    CacheRouteIndex,
+    CacheRoutePath
+};
+
+ResourcesCache::ResourcesCache(ResourceAlloc* resourceAlloc)
+:resourceAlloc(resourceAlloc), key(), keyValue(0), loaded(false), buffer(),
+position(0), allRoutes(0), routeIndexes() {
+
+}
+
+ResourcesCache::~ResourcesCache() {
+
+}
+
+bool ResourcesCache::Load() {
+    this->CreateKey();
+    std::ifstream file(resourceAlloc->GetSimulType()->GetInputOutput()
+    ->GetResourcesCacheName(key), std::ios::binary);
+
+    if(!file.is_open())
+        return false;
+
+    buffer.assign(std::istreambuf_iterator<char>(file),
+                  std::istreambuf_iterator<char>());
+    position = sizeof(cacheSignature) + sizeof(version) + sizeof(keyValue);
+
+    if(buffer.size() < position ||
+    buffer.compare(0, sizeof(cacheSignature), cacheSignature,
+                   sizeof(cacheSignature)) != 0 ||
+    std::memcmp(&buffer[sizeof(cacheSignature)], &version,
+                sizeof(version)) != 0 ||
+    std::memcmp(&buffer[sizeof(cacheSignature) + sizeof(version)], &keyValue,
+                sizeof(keyValue)) != 0){
+        buffer.clear();
+        return false;
+    }
+
+    Resources* resources = resourceAlloc->GetResources();
+    std::vector<std::vector<std::vector<std::shared_ptr<Route>>>>
+    protectionAllRoutes, interRoutes;
+    std::vector<std::vector<std::vector<std::vector<std::shared_ptr<Route>>>>>
+    protectionAllRoutesGroups, subRoutes;
+    std::vector<std::vector<std::vector<std::vector<unsigned int>>>> numReg,
+    numSlots;
+    std::vector<std::vector<std::vector<std::vector<std::vector<
+    unsigned int>>>>> numSlotsPerSubRoute;
+    std::vector<std::vector<std::vector<std::vector<std::vector<
+    TypeModulation>>>>> subRoutesModulation;
+
+    loaded = this->Read(allRoutes) &&
+             allRoutes.size() == resources->allRoutes.size() &&
+             this->Read(protectionAllRoutes) &&
+             this->Read(protectionAllRoutesGroups) &&
+             this->Read(interRoutes) && this->Read(subRoutes) &&
+             this->Read(numReg) && this->Read(numSlots) &&
+             this->Read(numSlotsPerSubRoute) &&
+             this->Read(subRoutesModulation) && position == buffer.size();
+
+    if(loaded){
+        resources->allRoutes.swap(allRoutes);
+        resources->protectionAllRoutes.swap(protectionAllRoutes);
+        resources->protectionAllRoutesGroups.swap(protectionAllRoutesGroups);
+        resources->interRoutes.swap(interRoutes);
+        resources->subRoutes.swap(subRoutes);
+        resources->numReg.swap(numReg);
+        resources->numSlots.swap(numSlots);
+        resources->numSlotsPerSubRoute.swap(numSlotsPerSubRoute);
+        resources->subRoutesModulation.swap(subRoutesModulation);
+    }
+    else{
+        std::cerr << "Invalid offline tables cache file: " << resourceAlloc
+                  ->GetSimulType()->GetInputOutput()
+                  ->GetResourcesCacheName(key) << std::endl;
+    }
+    allRoutes.clear();
+    buffer.clear();
+
+    return loaded;
+}
+
+void ResourcesCache::Save() {
+
+    if(loaded)
+        return;
+
+    if(key.empty())
+        this->CreateKey();
+    Resources* resources = resourceAlloc->GetResources();
+    std::string fileName = resourceAlloc->GetSimulType()->GetInputOutput()
+                           ->GetResourcesCacheName(key);
+    std::string tempName = fileName + "." +
+                           std::to_string(std::random_device()()) + ".tmp";
+    std::ofstream file(tempName, std::ios::binary | std::ios::trunc);
+
+    if(!file.is_open()){
+        std::cerr << "Unable to write the offline tables cache file: "
+                  << fileName << std::endl;
+        return;
+    }
+
+    file.write(cacheSignature, sizeof(cacheSignature));
+    file.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    file.write(reinterpret_cast<const char*>(&keyValue), sizeof(keyValue));
+
+    //All routes are written first by their paths, the other containers
+    //refer to them by their indexes.
+    routeIndexes.clear();
+    this->Write(file, resources->allRoutes);
+
+    for(std::uint32_t a = 0; a < resources->allRoutes.size(); a++){
+        for(std::uint32_t b = 0; b < resources->allRoutes.at(a).size(); b++){
+
+            if(resources->allRoutes.at(a).at(b) != nullptr)
+                routeIndexes.emplace(resources->allRoutes.at(a).at(b).get(),
+                                     std::make_pair(a, b));
+        }
+    }
+
+    this->Write(file, resources->protectionAllRoutes);
+    this->Write(file, resources->protectionAllRoutesGroups);
+    this->Write(file, resources->interRoutes);
+    this->Write(file, resources->subRoutes);
+    this->Write(file, resources->numReg);
+    this->Write(file, resources->numSlots);
+    this->Write(file, resources->numSlotsPerSubRoute);
+    this->Write(file, resources->subRoutesModulation);
+    routeIndexes.clear();
+    file.close();
+
+    if(!file || std::rename(tempName.c_str(), fileName.c_str()) != 0){
+        std::cerr << "Unable to write the offline tables cache file: "
+                  << fileName << std::endl;
+        std::remove(tempName.c_str());
+    }
+}
+
+bool ResourcesCache::IsLoaded() const {
+    return loaded;
+}
+
+bool ResourcesCache::IsCacheableRouting() const {
+
+    switch(resourceAlloc->GetSimulType()->GetOptions()->GetRoutingOption()){
+        case RoutingDJK:
+        case RoutingYEN:
+        case RoutingMP:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void ResourcesCache::CreateKey() {
+    SimulationType* simulType = resourceAlloc->GetSimulType();
+    Options* options = simulType->GetOptions();
+    Parameters* parameters = simulType->GetParameters();
+    std::ifstream topologyFile;
+    std::string topology;
+
+    //64 bits FNV-1a offset basis.
+    keyValue = 14695981039346656037ULL;
+
+    simulType->GetInputOutput()->LoadTopology(topologyFile);
+    topology.assign(std::istreambuf_iterator<char>(topologyFile),
+                    std::istreambuf_iterator<char>());
+    this->AddToKey(topology.data(), topology.size());
+
+    for(auto it: resourceAlloc->GetTraffic()->GetVecTraffic())
+        this->AddToKey(it);
+
+    this->AddToKey(options->GetTopologyOption());
+    this->AddToKey(options->GetRoutingOption());
+    this->AddToKey(options->GetSpecAllOption());
+    this->AddToKey(options->GetLinkCostType());
+    this->AddToKey(options->GetResourAllocOption());
+    this->AddToKey(options->GetPhyLayerOption());
+    this->AddToKey(options->GetNetworkOption());
+    this->AddToKey(options->GetDevicesOption());
+    this->AddToKey(options->GetRegenerationOption());
+    this->AddToKey(options->GetProtectionOption());
+
+    this->AddToKey(parameters->GetSlotBandwidth());
+    this->AddToKey(parameters->GetNumberSlots());
+    this->AddToKey(parameters->GetNumberCores());
+    this->AddToKey(parameters->GetNumberRoutes());
+    this->AddToKey(parameters->GetMaxSectionLegnth());
+    this->AddToKey(parameters->GetNumberPolarizations());
+    this->AddToKey(parameters->GetGuardBand());
+    this->AddToKey(parameters->GetNumberPDPPprotectionRoutes());
+    this->AddToKey(parameters->GetNumberMPRGroups());
+
+    std::ostringstream auxStream;
+    auxStream << std::hex << std::setw(16) << std::setfill('0') << keyValue;
+    key = auxStream.str();
+}
+
+void ResourcesCache::AddToKey(const void* data, std::size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+
+    for(std::size_t a = 0; a < size; a++){
+        keyValue ^= bytes[a];
+        keyValue *= 1099511628211ULL;
+    }
+}
+
+template <typename T>
+void ResourcesCache::AddToKey(const T& value) {
+    this->AddToKey(&value, sizeof(value));
+}
+
+void ResourcesCache::Write(std::ostream& file, std::uint32_t value) const {
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void ResourcesCache::Write(std::ostream& file, TypeModulation mod) const {
+    this->Write(file, static_cast<std::uint32_t>(mod));
+}
+
+void ResourcesCache::Write(std::ostream& file,
+const std::shared_ptr<Route>& route) const {
+
+    if(route == nullptr){
+        this->Write(file, CacheRouteNull);
+        return;
+    }
+    auto it = routeIndexes.find(route.get());
+
+    if(it != routeIndexes.end()){
+        this->Write(file, CacheRouteIndex);
+        this->Write(file, it->second.first);
+        this->Write(file, it->second.second);
+        return;
+    }
+    this->Write(file, CacheRoutePath);
+    this->Write(file, static_cast<std::uint32_t>(route->GetPath().size()));
+
+    for(auto node: route->GetPath())
+        this->Write(file, static_cast<std::uint32_t>(node));
+}
+
+template <typename T>
+void ResourcesCache::Write(std::ostream& file, const std::vector<T>& vec)
+const {
+    this->Write(file, static_cast<std::uint32_t>(vec.size()));
+
+    for(const auto& it: vec)
+        this->Write(file, it);
+}
+
+bool ResourcesCache::Read(std::uint32_t& value) {
+
+    if(buffer.size() - position < sizeof(value))
+        return false;
+    std::memcpy(&value, &buffer[position], sizeof(value));
+    position += sizeof(value);
+
+    return true;
+}
+
+bool ResourcesCache::Read(TypeModulation& mod) {
+    std::uint32_t value;
+
+    if(!this->Read(value) || value > LastModulation)
+        return false;
+    mod = static_cast<TypeModulation>(value);
+
+    return true;
+}
+
+bool ResourcesCache::Read(std::shared_ptr<Route>& route) {
+    std::uint32_t tag, size, node, pairIndex, routeIndex;
+    unsigned int numNodes = resourceAlloc->GetTopology()->GetNumNodes();
+    std::vector<int> path(0);
+    route.reset();
+
+    if(!this->Read(tag))
+        return false;
+
+    switch(tag){
+        case CacheRouteNull:
+            return true;
+        case CacheRouteIndex:
+            if(!this->Read(pairIndex) || !this->Read(routeIndex) ||
+            pairIndex >= allRoutes.size() ||
+            routeIndex >= allRoutes.at(pairIndex).size())
+                return false;
+            route = allRoutes.at(pairIndex).at(routeIndex);
+            return true;
+        case CacheRoutePath:
+            if(!this->Read(size) || size > numNodes)
+                return false;
+
+            for(std::uint32_t a = 0; a < size; a++){
+                if(!this->Read(node) || node >= numNodes)
+                    return false;
+                path.push_back(node);
+            }
+            route = std::make_shared<Route>(resourceAlloc, path);
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+bool ResourcesCache::Read(std::vector<T>& vec) {
+    std::uint32_t size;
+
+    //Each element takes at least four bytes in the file.
+    if(!this->Read(size) || size > (buffer.size() - position) / 4)
+        return false;
+    vec.clear();
+    vec.resize(size);
+
+    for(auto& it: vec){
+        if(!this->Read(it))
+            return false;
+    }
+
+    return true;
+}
@@ -16,10 +16,11 @@
 #include "../../include/Structure/Topology.h"
 #include "../../include/Structure/Link.h"
 #include "../../include/Structure/Node.h"
+#include "../../include/ResourceAllocation/Signal.h"
 
 Route::Route(ResourceAlloc* rsaAlg, const std::vector<int>& path)
 :resourceAlloc(rsaAlg), topology(rsaAlg->GetTopology()), path(path),
-pathNodes(0), pathLinks(0), cost(0.0) {
+pathNodes(0), pathLinks(0), cost(0.0), osnr(0.0), osnrCalculated(false) {
 
     if(path.size() != 0) {
         for (auto it: this->path) {
@@ -143,6 +144,21 @@ void Route::SetCost() {
     this->SetCost(cost);
 }
 
+double Route::GetOSNR() const {
+    
+    if(!this->osnrCalculated){
+        Signal signal;
+        
+        for(unsigned int a = 0; a < this->GetNumHops(); a++)
+            this->GetLink(a)->CalcSignal(&signal);
+        
+        this->osnr = signal.GetOSNR();
+        this->osnrCalculated = true;
+    }
+    
+    return this->osnr;
+}
+
 Link* Route::GetLink(unsigned int index) const {
     assert(index < this->GetNumHops());
     
@@ -207,6 +223,7 @@ void Route::AddNodeAtEnd(NodeIndex node) {
 
     path.push_back(int(node));
     pathNodes.push_back(this->topology->GetNode(node));
+    osnrCalculated = false;
 
     if(pathNodes.size() >= 2)
         pathLinks.push_back(topology->GetLink(pathNodes.at(pathNodes.size()-2)->GetNodeId(),
@@ -11,6 +11,12 @@
  * Created on November 19, 2018, 11:43 PM
  */
 
+#include <queue>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <functional>
+
 #include "../../include/ResourceAllocation/Routing.h"
 #include "../../include/ResourceAllocation/Route.h"
 #include "../../include/ResourceAllocation/Resources.h"
@@ -22,6 +28,7 @@
 #include "../../include/Calls/Call.h"
 #include "../../include/Data/Data.h"
 #include "../../include/Data/Parameters.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 bool RouteCompare::operator()(const std::shared_ptr<Route>& routeA,
                               const std::shared_ptr<Route>& routeB) {
@@ -45,9 +52,23 @@ void Routing::Load() {
 
     if(routingOption == RoutingYEN || routingOption == RoutingBSR_YEN)
         this->SetK(parameters->GetNumberRoutes());
+    
+    unsigned int numNodes = topology->GetNumNodes();
+    Link* link;
+    outputLinks.assign(numNodes, std::vector<Link*>(0));
+    
+    for(unsigned int orN = 0; orN < numNodes; orN++){
+        for(unsigned int deN = 0; deN < numNodes; deN++){
+            link = topology->GetLink(orN, deN);
+            
+            if(link != nullptr)
+                outputLinks.at(orN).push_back(link);
+        }
+    }
 }
 
 void Routing::RoutingCall(Call* call) {
+    PROFILE_SCOPE(PhaseRouting);
     
     switch(this->routingOption){
         case RoutingDJK:
@@ -73,136 +94,89 @@ void Routing::SetOfflineRouting(Call* call) {
 }
 
 void Routing::Dijkstra() {
-    std::shared_ptr<Route> route;
     unsigned int numNodes = this->topology->GetNumNodes();
+    unsigned int numThreads = std::max(1U, std::min(numNodes, 
+    std::thread::hardware_concurrency()));
+    std::vector<std::vector<std::shared_ptr<Route>>> nodeRoutes(numNodes);
+    std::vector<std::thread> threads;
+    std::atomic<unsigned int> nextNode(0);
+    
+    for(unsigned int t = 0; t < numThreads; t++){
+        threads.push_back(std::thread([&](){
+            std::vector<int> precedent;
+            std::vector<bool> reached;
+            unsigned int orN;
+            
+            while((orN = nextNode++) < numNodes){
+                this->Dijkstra(orN, numNodes, std::vector<bool>(), 
+                std::vector<bool>(), precedent, reached);
+                nodeRoutes.at(orN).assign(numNodes, nullptr);
+                
+                for(unsigned int deN = 0; deN < numNodes; deN++){
+                    if(orN != deN && reached.at(deN))
+                        nodeRoutes.at(orN).at(deN) = this->CreateRoute(orN, 
+                        deN, precedent);
+                }
+            }
+        }));
+    }
+    
+    for(auto& it: threads)
+        it.join();
     
     for(unsigned int orN = 0; orN < numNodes; orN++){
         for(unsigned int deN = 0; deN < numNodes; deN++){
-            if(orN != deN){
-                route = this->Dijkstra(orN, deN);
-            }
-            else{
-                route = nullptr;
-            }
-            resources->SetRoute(orN, deN, route);
-            route.reset();
+            resources->SetRoute(orN, deN, nodeRoutes.at(orN).at(deN));
         }
     }
 }
 
 std::shared_ptr<Route> Routing::Dijkstra(NodeIndex orNode, NodeIndex deNode) {
     assert(orNode != deNode);
+    std::vector<int> precedent;
+    std::vector<bool> reached;
     
-    int k = -1, h, hops;
-    unsigned int i, j, setVertexes;
-    long double min;
-    unsigned int numNodes = this->topology->GetNumNodes();
-    std::vector<int> path(0);
-    std::vector<int> invPath(0);
-    Link* auxLink;
-    std::shared_ptr<Route> routeDJK = nullptr;
-    bool networkDisconnected = false;
+    this->Dijkstra(orNode, deNode, std::vector<bool>(), std::vector<bool>(), 
+                   precedent, reached);
     
-    std::vector<double> custoVertice(numNodes);
-    std::vector<int> precedente(numNodes);
-    std::vector<int> pathRev(numNodes);
-    std::vector<bool> status(numNodes);
+    if(!reached.at(deNode))
+        return nullptr;
     
-    //Initializes all vertices with infinite cost
-    //and the source vertice with cost zero
-    for(i = 0; i < numNodes; i++){
-        if(i != orNode)
-            custoVertice.at(i) = Def::Max_Double;
-        else
-            custoVertice.at(i) = 0.0;
-        precedente.at(i) = -1;
-        status.at(i) = 0;
-    }
-    setVertexes = numNodes;
-
-    while(setVertexes > 0 && !networkDisconnected){
-
-        min = Def::Max_Double;
-        
-        for(i = 0; i < numNodes; i++)
-            if((status.at(i) == 0) && (custoVertice.at(i) < min)){
-                min = custoVertice.at(i);
-                k = i;
-            }
-
-        if(k == (int) deNode)
-            break;
-        
-        status.at(k) = 1;
-        setVertexes--;
-        bool outputLinkFound = false;
+    return this->CreateRoute(orNode, deNode, precedent);
+}
 
-        for(j = 0; j < numNodes; j++){
-            auxLink = this->topology->GetLink((unsigned int) k, 
-                                           (unsigned int) j);
-            //(link->GetCost() < Def::Max_Double)
-            if((auxLink != NULL) && (auxLink->IsLinkWorking()) && 
-               (this->topology->GetNode(auxLink->GetOrigimNode())->
-               IsNodeWorking()) &&
-               (this->topology->GetNode(auxLink->GetDestinationNode())->
-               IsNodeWorking())){
-                outputLinkFound = true;
-                
-                if( (status.at(j) == 0) && (custoVertice.at(k) + 
-                  auxLink->GetCost() < custoVertice.at(j)) ){
-                   custoVertice.at(j) = custoVertice.at(k) + auxLink->GetCost();
-                   precedente.at(j) = k;
-                }
-            }
-        }
-        
-        if(!outputLinkFound)
-            networkDisconnected = true;
-    }
+void Routing::YEN() {
+    unsigned int numNodes = this->topology->GetNumNodes();
+    unsigned int numThreads = std::max(1U, std::min(numNodes, 
+    std::thread::hardware_concurrency()));
+    std::vector<std::vector<std::shared_ptr<Route>>> pairRoutes(numNodes * 
+                                                                numNodes);
+    std::vector<std::thread> threads;
+    std::atomic<unsigned int> nextNode(0);
     
-    if(!networkDisconnected){
-        path.push_back(deNode);
-        hops = 0;
-        j = deNode;
-        
-        while(j != orNode){
-            hops++;
-            if(precedente.at(j) != -1){
-                path.push_back(precedente.at(j));
-                j = precedente.at(j);
-            }
-            else{
-                networkDisconnected = true;
-                break;
-            }
-        }
-        if(!networkDisconnected){     
+    for(unsigned int t = 0; t < numThreads; t++){
+        threads.push_back(std::thread([&](){
+            unsigned int orN;
             
-            for(h = 0; h <= hops; h++)
-                invPath.push_back(path.at(hops-h));
-
-            routeDJK = std::make_shared<Route>(this->GetResourceAlloc(), 
-                                               invPath);
-        }
+            while((orN = nextNode++) < numNodes){
+                for(unsigned int deN = 0; deN < numNodes; deN++){
+                    if(orN != deN)
+                        pairRoutes.at(orN*numNodes + deN) = this->YEN(orN, 
+                                                                      deN);
+                    else
+                        pairRoutes.at(orN*numNodes + deN).resize(this->GetK(), 
+                                                                 nullptr);
+                }
+            }
+        }));
     }
     
-    return routeDJK;
-}
-
-void Routing::YEN() {
-    std::vector<std::shared_ptr<Route>> routes;
-    unsigned int numNodes = this->topology->GetNumNodes();
+    for(auto& it: threads)
+        it.join();
     
     for(unsigned int orN = 0; orN < numNodes; orN++){
         for(unsigned int deN = 0; deN < numNodes; deN++){
-            if(orN != deN){
-                routes = this->YEN(orN, deN);
-            }
-            else{
-                routes.resize(this->GetK(), nullptr);
-            }
-            resources->SetRoutes(orN, deN, routes);
-            routes.clear();
+            resources->SetRoutes(orN, deN, pairRoutes.at(orN*numNodes + deN));
         }
     }
 }
@@ -210,61 +184,79 @@ void Routing::YEN() {
 std::vector<std::shared_ptr<Route> > Routing::YEN(NodeIndex orNode, 
                                                   NodeIndex deNode) {
     assert(orNode != deNode);
+    unsigned int numNodes = this->topology->GetNumNodes();
     std::vector<std::shared_ptr<Route>> routesYEN;
     std::priority_queue<std::shared_ptr<Route>, 
                         std::vector<std::shared_ptr<Route>>,
                         RouteCompare> candidateRoutes;
-    Node* spurNode;
-    std::shared_ptr<Route> spurPath;
-    std::shared_ptr<Route> rootPath;
-    std::shared_ptr<Route> totalPath;
+    std::vector<bool> removedLinks(numNodes * numNodes, false);
+    std::vector<bool> removedNodes(numNodes, false);
+    std::vector<unsigned int> removedLinksIndexes;
+    std::vector<int> precedent;
+    std::vector<bool> reached;
+    std::vector<int> prevPath;
+    std::vector<int> totalPath;
+    NodeIndex spurNode;
     
     // Determine the shortest path from the source to the destination.
     std::shared_ptr<Route> newRoute = this->Dijkstra(orNode, deNode);
     routesYEN.push_back(newRoute);
     
     for(unsigned int k = 1; k < this->K; k++){
-        unsigned int auxSize = routesYEN.at(k-1)->GetNumNodes() - 2;
+        prevPath = routesYEN.at(k-1)->GetPath();
+        unsigned int auxSize = prevPath.size() - 2;
         
         //The spurNode ranges from the first node to the next to last node 
         //in the previous k-shortest path.
         for(unsigned int i = 0; i <= auxSize; i++){
             //spurNode is retrieved from the previous k-shortest path, k − 1.
-            spurNode = routesYEN.at(k-1)->GetNode(i);
-            // The sequence of nodes from the source to the spurNode of the 
-            //previous k-shortest path.
-            rootPath = routesYEN.at(k-1)->CreatePartialRoute(0, i);
+            spurNode = prevPath.at(i);
             
-            for(auto it: routesYEN){
+            for(auto& it: routesYEN){
                 //Remove the links that are part of the previous shortest 
                 //paths which share the same rootPath.
                 if(i < it->GetNumNodes()){
-                    newRoute = it->CreatePartialRoute(0, i);
-                    if(rootPath->GetPath() == newRoute->GetPath()){
-                        it->GetLink(i)->SetLinkState(false);
+                    const std::vector<int>& path = it->GetPath();
+                    
+                    if(std::equal(path.begin(), path.begin() + i + 1, 
+                    prevPath.begin())){
+                        removedLinksIndexes.push_back(path.at(i) * numNodes + 
+                                                      path.at(i+1));
+                        removedLinks.at(removedLinksIndexes.back()) = true;
                     }
                 }
             }
             
-            for(unsigned int  a = 0; a < rootPath->GetNumNodes(); a++){
-                if(rootPath->GetNode(a)->GetNodeId() == spurNode->GetNodeId())
-                    continue;
-                rootPath->GetNode(a)->SetNodeState(false);
-            }
+            //The rootPath nodes, except the spurNode, are removed.
+            for(unsigned int a = 0; a < i; a++)
+                removedNodes.at(prevPath.at(a)) = true;
             
             // Calculate the spurPath from the spurNode to the destination.
-            spurPath = this->Dijkstra(spurNode->GetNodeId(), deNode);
+            this->Dijkstra(spurNode, deNode, removedLinks, removedNodes, 
+                           precedent, reached);
             
-            if(spurPath != nullptr){
+            if(reached.at(deNode)){
                 // Entire path is made up of the rootPath and spurPath.
-                totalPath = rootPath->AddRoute(spurPath);
+                totalPath.assign(prevPath.begin(), prevPath.begin() + i);
+                
+                for(int node = deNode; node != (int) spurNode; 
+                node = precedent.at(node))
+                    totalPath.push_back(node);
+                totalPath.push_back(spurNode);
+                std::reverse(totalPath.begin() + i, totalPath.end());
+                
                 // Add the potential k-shortest path to the queue.
-                candidateRoutes.push(totalPath);
+                candidateRoutes.push(std::make_shared<Route>(
+                                     this->GetResourceAlloc(), totalPath));
             }
             
             // Add back the edges and nodes that were removed from the graph.
-            this->topology->SetAllLinksWorking();
-            rootPath->SetAllNodesWorking();
+            for(auto it: removedLinksIndexes)
+                removedLinks.at(it) = false;
+            removedLinksIndexes.clear();
+            
+            for(unsigned int a = 0; a < i; a++)
+                removedNodes.at(prevPath.at(a)) = false;
         }
         if(candidateRoutes.empty())
             break;    
@@ -463,6 +455,10 @@ unsigned int numNodes = topology->GetNumNodes();
 
 void Routing::ProtectionDisjointYEN() {
     
+    //The protection routes were loaded with the other offline tables.
+    if(this->resourceAlloc->IsResourcesCacheLoaded())
+        return;
+    
     std::vector<std::shared_ptr<Route>> routes;
     unsigned int numNodes = this->topology->GetNumNodes();
     unsigned int numRoutes;
@@ -805,6 +801,11 @@ std::vector<std::shared_ptr<Route>> routes){
 }
 
 void Routing::MultiPathRouting() {
+    
+    //The routes and their groups were loaded with the other offline tables.
+    if(this->resourceAlloc->IsResourcesCacheLoaded())
+        return;
+    
     this->AllRoutes();  //generate all routes between each source-destination pair
 
     unsigned int nodePairIndex;
@@ -1104,6 +1105,95 @@ void Routing::SetTopology(Topology* topology) {
     this->topology = topology;
 }
 
+void Routing::Dijkstra(NodeIndex orNode, NodeIndex deNode, 
+const std::vector<bool>& removedLinks, const std::vector<bool>& removedNodes, 
+std::vector<int>& precedent, std::vector<bool>& reached) const {
+    unsigned int numNodes = this->topology->GetNumNodes();
+    std::priority_queue<std::pair<double, NodeIndex>, 
+                        std::vector<std::pair<double, NodeIndex>>,
+                        std::greater<std::pair<double, NodeIndex>>> heap;
+    std::vector<double> nodeCost(numNodes, Def::Max_Double);
+    std::vector<bool> status(numNodes, false);
+    bool networkDisconnected = false;
+    NodeIndex k;
+    double cost;
+    
+    precedent.assign(numNodes, -1);
+    reached.assign(numNodes, false);
+    nodeCost.at(orNode) = 0.0;
+    heap.push(std::make_pair(0.0, orNode));
+    
+    while(!heap.empty()){
+        k = heap.top().second;
+        heap.pop();
+        
+        if(status.at(k))
+            continue;
+        status.at(k) = true;
+        
+        //The array version stops at the first node without working output 
+        //links, so the nodes reached after it have no route.
+        if(!networkDisconnected)
+            reached.at(k) = true;
+        
+        if(k == deNode)
+            break;
+        bool outputLinkFound = false;
+        
+        for(auto link: this->outputLinks.at(k)){
+            
+            if(!this->IsLinkUsable(link, removedLinks, removedNodes))
+                continue;
+            outputLinkFound = true;
+            cost = nodeCost.at(k) + link->GetCost();
+            
+            if(!status.at(link->GetDestinationNode()) && 
+            cost < nodeCost.at(link->GetDestinationNode())){
+                nodeCost.at(link->GetDestinationNode()) = cost;
+                precedent.at(link->GetDestinationNode()) = k;
+                heap.push(std::make_pair(cost, link->GetDestinationNode()));
+            }
+        }
+        
+        if(!outputLinkFound){
+            networkDisconnected = true;
+            
+            if(deNode < numNodes)
+                break;
+        }
+    }
+}
+
+bool Routing::IsLinkUsable(const Link* link, 
+const std::vector<bool>& removedLinks, const std::vector<bool>& removedNodes) 
+const {
+    NodeIndex orNode = link->GetOrigimNode();
+    NodeIndex deNode = link->GetDestinationNode();
+    
+    if(!removedLinks.empty() && 
+    removedLinks.at(orNode * this->topology->GetNumNodes() + deNode))
+        return false;
+    if(!removedNodes.empty() && 
+    (removedNodes.at(orNode) || removedNodes.at(deNode)))
+        return false;
+    
+    return link->IsLinkWorking() && 
+           this->topology->GetNode(orNode)->IsNodeWorking() &&
+           this->topology->GetNode(deNode)->IsNodeWorking();
+}
+
+std::shared_ptr<Route> Routing::CreateRoute(NodeIndex orNode, 
+NodeIndex deNode, const std::vector<int>& precedent) const {
+    std::vector<int> path(0);
+    
+    for(int node = deNode; node != (int) orNode; node = precedent.at(node))
+        path.push_back(node);
+    path.push_back(orNode);
+    std::reverse(path.begin(), path.end());
+    
+    return std::make_shared<Route>(this->GetResourceAlloc(), path);
+}
+
 unsigned int Routing::GetK() const {
     return K;
 }
@@ -19,7 +19,11 @@
 #include "../../include/Calls/CallDevices.h"
 #include "../../include/Structure/Topology.h"
 #include "../../include/Structure/Node.h"
+#include "../../include/Structure/SlotMask.h"
+#include "../../include/SimulationType/SimulationType.h"
+#include "../../include/GeneralClasses/RandomStreams.h"
 #include "../../include/GeneralClasses/Def.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 SA::SA(ResourceAlloc* rsa, SpectrumAllocationOption option, Topology* topology) 
 :resourceAlloc(rsa), specAllOption(option), topology(topology) {
@@ -34,15 +38,21 @@ void SA::SpecAllocation(Call* call) {
     call->SetCore(0);
     
     switch(this->specAllOption){
-        case SpecAllRandom:
+        case SpecAllRandom:{
+            PROFILE_SCOPE(PhaseSpecAllocRandom);
             this->Random(call);
             break;
-        case SpecAllFF:
+        }
+        case SpecAllFF:{
+            PROFILE_SCOPE(PhaseSpecAllocFF);
             this->FirstFit(call);
             break;
-        case SpecAllMSCL:
+        }
+        case SpecAllMSCL:{
+            PROFILE_SCOPE(PhaseSpecAllocMSCL);
             this->MSCL(call);
             break;
+        }
         default:
             std::cerr << "Invalid spectrum allocation option" << std::endl;
             std::abort();
@@ -82,9 +92,11 @@ void SA::Random(Call* call) {
     std::vector<unsigned int> vecSlots(0);
     
     vecSlots = this->FirstFitSlots(call);
+    PROFILE_COUNT(CounterCandidateSlots, vecSlots.size());
     
     if(!vecSlots.empty()){
-        std::shuffle(vecSlots.begin(), vecSlots.end(), Def::pseudoRandomEngine);
+        std::shuffle(vecSlots.begin(), vecSlots.end(), this->resourceAlloc->
+        GetSimulType()->GetRandomStreams()->GetEngine(StreamSpecAlloc));
     
         call->SetFirstSlot(vecSlots.back());
         call->SetLastSlot(vecSlots.back() + call->GetNumberSlots() - 1);
@@ -94,22 +106,12 @@ void SA::Random(Call* call) {
 void SA::FirstFit(Call* call) {
     Route* route = call->GetRoute();
     unsigned int numSlotsReq = call->GetNumberSlots();
-    unsigned int topNumSlots = this->topology->GetNumSlots();
-    unsigned int numContigSlots = 0;
+    SlotIndex firstSlot = resourceAlloc->GetDispMask(route, 0)
+                                       .FindFirstBlock(numSlotsReq);
     
-    for(unsigned int slot = 0; slot < topNumSlots; slot++){
-        
-        if(resourceAlloc->CheckSlotDisp(route, slot)){
-            numContigSlots++;
-            
-            if(numContigSlots == numSlotsReq){
-                call->SetFirstSlot(slot - numSlotsReq + 1);
-                call->SetLastSlot(slot);
-                break;
-            }
-        }
-        else
-            numContigSlots = 0;
+    if(firstSlot != Def::Max_UnInt){
+        call->SetFirstSlot(firstSlot);
+        call->SetLastSlot(firstSlot + numSlotsReq - 1);
     }
 }
 
@@ -121,64 +123,40 @@ void SA::MSCL(Call* call) {
     unsigned int orNode = route->GetOrNode()->GetNodeId();
     unsigned int deNode = route->GetDeNode()->GetNodeId();
     
-    std::vector<std::shared_ptr<Route>> intRoutes =
+    const std::vector<std::shared_ptr<Route>>& intRoutes =
     this->resourceAlloc->GetInterRoutes(orNode, deNode, route);
     unsigned int numInterRoutesCheck =
     this->resourceAlloc->GetNumInterRoutesToCheck(orNode, deNode, route);
-    std::vector<unsigned> vecTrafficSlots = 
+    const std::vector<unsigned>& vecTrafficSlots = 
     this->resourceAlloc->GetNumSlotsTraffic();
     
-    unsigned int vetCapInic[numInterRoutesCheck+1];
-    unsigned int vetCapFin[numInterRoutesCheck+1];
     double perda, perdaMin = Def::Max_Double;
     unsigned int si = Def::Max_UnInt;
-    bool DispFitSi = false;    
+    bool DispFitSi = false;
     
-    std::vector<SlotState> auxVecDisp;
-    std::vector<std::vector<SlotState>> vecDisp;
-    vecDisp.resize(numInterRoutesCheck+1);
+    std::vector<SlotMask> vecDisp;
+    vecDisp.reserve(numInterRoutesCheck+1);
     for(unsigned int a = 0; a <= numInterRoutesCheck; a++){
         if(a != 0)
             auxRoute = intRoutes.at(a-1).get();
         else
             auxRoute = route;
         
-        vecDisp.at(a) = resourceAlloc->GetDispVector(auxRoute);
+        vecDisp.push_back(resourceAlloc->GetDispMask(auxRoute, 0));
     }
     
     for(unsigned int s = 0; s < (numSlotsTop - numSlotsReq + 1); s++){
-        DispFitSi = resourceAlloc->CheckSlotsDisp(route, s, 
-                                                  s + numSlotsReq - 1);
+        DispFitSi = vecDisp.front().Test(s, s + numSlotsReq - 1);
         
         if(DispFitSi){
+            PROFILE_COUNT(CounterCandidateSlots, 1);
             perda = 0.0;
             
             for(unsigned int r = 0; r <= numInterRoutesCheck; r++){
-                
-                auxVecDisp = vecDisp.at(r);
-                
-                vetCapInic[r] = 0;
-                vetCapFin[r] = 0;
-                
-                //Calculates the initial capacity based on the number of 
-                //allocation forms.
-                for(unsigned i = 0; i < vecTrafficSlots.size(); i++){
-                    vetCapInic[r] += resourceAlloc->
-                    CalcNumFormAloc(vecTrafficSlots.at(i), auxVecDisp);
-                }
                 //Calculates the requisition allocation impact in the 
                 //interfering routes for each set of slots
-                for(unsigned int i = s; i < s + numSlotsReq; i++)
-                    auxVecDisp.at(i) = occupied;
-                
-                //Calculates the final capacity based on the number of 
-                //allocation forms.
-                for(unsigned i = 0; i < vecTrafficSlots.size(); i++){
-                    vetCapFin[r] += resourceAlloc->
-                    CalcNumFormAloc(vecTrafficSlots.at(i), auxVecDisp);
-                }
-                
-                perda += vetCapInic[r] - vetCapFin[r];
+                perda += this->CalcCapacityLoss(vecDisp.at(r), s, 
+                         s + numSlotsReq - 1, vecTrafficSlots);
                 
                 if(perda >= perdaMin)
                     break;
@@ -205,31 +183,56 @@ ResourceAlloc* SA::GetResourceAlloc(){
     return this->resourceAlloc;
 }
 
-int SA::CalcNumFormAloc(int L, bool* Disp,int tam) { 
-    int sum = 0, si;//si eh o slot inicial da alocacao, que vai de 0 ate SE-L
-    int cont = 0;
-    for(si = 0; si < tam; si++){
-        if(Disp[si] == false){
-            if(cont >= L){
-                 sum += cont - L + 1;
-                 //sum += floor (cont/L);
-            }
-                cont = 0;
+unsigned int SA::CalcCapacityLoss(const SlotMask& dispMask, SlotIndex firstSlot,
+SlotIndex lastSlot, const std::vector<unsigned int>& vecTrafficSlots) const {
+    //Only the free blocks touched by the slots range change. They are 
+    //contained in the range extended by the free slots around it.
+    unsigned int sizeBefore = 0;
+    unsigned int sizeAfter = 0;
+    unsigned int sizeBlock;
+    unsigned int loss = 0;
+    
+    if(dispMask.Test(firstSlot))
+        sizeBefore = dispMask.CountSetBefore(firstSlot);
+    if(dispMask.Test(lastSlot))
+        sizeAfter = dispMask.CountSetAfter(lastSlot);
+    sizeBlock = sizeBefore;
+    
+    for(SlotIndex a = firstSlot; a <= lastSlot; a++){
+        
+        if(dispMask.Test(a))
+            sizeBlock++;
+        else if(sizeBlock > 0){
+            loss += this->CalcNumForms(sizeBlock, vecTrafficSlots);
+            sizeBlock = 0;
         }
-            else{
-                cont++;
-            }
     }
-    if(cont >= L){
-       sum += cont - L + 1;
+    sizeBlock += sizeAfter;
+    
+    if(sizeBlock > 0)
+        loss += this->CalcNumForms(sizeBlock, vecTrafficSlots);
+    
+    return loss - this->CalcNumForms(sizeBefore, vecTrafficSlots) - 
+           this->CalcNumForms(sizeAfter, vecTrafficSlots);
+}
+
+unsigned int SA::CalcNumForms(unsigned int sizeBlock, 
+const std::vector<unsigned int>& vecTrafficSlots) const {
+    unsigned int numForms = 0;
+    
+    for(auto callSize: vecTrafficSlots){
+        if(sizeBlock >= callSize)
+            numForms += sizeBlock - callSize + 1;
     }
-    return sum;
+    
+    return numForms;
 }
 
 std::vector<unsigned int> SA::RandomSlots() {
     std::vector<unsigned int> vecSlots = this->FirstFitSlots();
     
-    std::shuffle(vecSlots.begin(), vecSlots.end(), Def::pseudoRandomEngine);
+    std::shuffle(vecSlots.begin(), vecSlots.end(), this->resourceAlloc->
+    GetSimulType()->GetRandomStreams()->GetEngine(StreamSpecAlloc));
     
     return vecSlots;
 }
@@ -247,13 +250,13 @@ std::vector<unsigned int> SA::FirstFitSlots() {
 std::vector<unsigned int> SA::FirstFitSlots(Call* call) {
     Route* route = call->GetRoute();
     unsigned int numSlotsReq = call->GetNumberSlots();
-    unsigned int maxSlotIndex = this->topology->GetNumSlots() - numSlotsReq;
+    SlotMask blocksStart = resourceAlloc->GetDispMask(route, 0)
+                                        .GetBlocksStart(numSlotsReq);
     std::vector<unsigned int> slots(0);
     
-    for(unsigned int a = 0; a <= maxSlotIndex; a++){
-        if(resourceAlloc->CheckSlotsDisp(route, a, a + numSlotsReq - 1)){
-            slots.push_back(a);
-        }
+    for(SlotIndex a = blocksStart.FindNext(0); a != Def::Max_UnInt; 
+    a = blocksStart.FindNext(a + 1)){
+        slots.push_back(a);
     }
     
     return slots;
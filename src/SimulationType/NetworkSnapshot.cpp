@@ -0,0 +1,139 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   NetworkSnapshot.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 6:25 PM
+ */
+
+#include "../../include/SimulationType/NetworkSnapshot.h"
+#include "../../include/SimulationType/SimulationType.h"
+#include "../../include/Structure/Topology.h"
+#include "../../include/Structure/Link.h"
+#include "../../include/Structure/NodeDevices.h"
+#include "../../include/Calls/EventGenerator.h"
+#include "../../include/Data/Options.h"
+
+NetworkSnapshot::NetworkSnapshot(SimulationType* simulType)
+:simulType(simulType), saved(false), networkLoad(0.0), simulationTime(0.0),
+linksState(0), regeneratorsState(0), transpondersState(0), activeCalls(0),
+engines(0), runIndex(0) {
+
+}
+
+NetworkSnapshot::~NetworkSnapshot() {
+
+}
+
+void NetworkSnapshot::Save() {
+    Topology* topology = this->simulType->GetTopology();
+    EventGenerator* generator = this->simulType->GetCallGenerator();
+    unsigned int numNodes = topology->GetNumNodes();
+    Link* link;
+    NodeDevices* node;
+    this->Clear();
+
+    this->linksState.resize(numNodes * numNodes);
+
+    for(unsigned int a = 0; a < numNodes; a++){
+        for(unsigned int b = 0; b < numNodes; b++){
+            link = topology->GetLink(a, b);
+
+            if(link != nullptr)
+                this->linksState.at(a * numNodes + b) = link->GetCoresState();
+        }
+    }
+
+    if(this->simulType->GetOptions()->GetDevicesOption() == DevicesEnabled){
+
+        for(unsigned int a = 0; a < numNodes; a++){
+            node = dynamic_cast<NodeDevices*>(topology->GetNode(a));
+            this->regeneratorsState.push_back(node->GetRegeneratorsState());
+            this->transpondersState.push_back(node->GetTranspondersState());
+        }
+    }
+
+    this->activeCalls = generator->GetActiveCalls();
+    this->simulationTime = generator->GetSimulationTime();
+    this->networkLoad = generator->GetNetworkLoad();
+    this->engines = this->simulType->GetRandomStreams()->GetEngines();
+    this->runIndex = this->simulType->GetRunIndex();
+    this->saved = true;
+}
+
+void NetworkSnapshot::Restore() const {
+    assert(this->IsValid());
+    Topology* topology = this->simulType->GetTopology();
+    RandomStreams* randomStreams = this->simulType->GetRandomStreams();
+    unsigned int numNodes = topology->GetNumNodes();
+    Link* link;
+    NodeDevices* node;
+
+    for(unsigned int a = 0; a < numNodes; a++){
+        for(unsigned int b = 0; b < numNodes; b++){
+            link = topology->GetLink(a, b);
+
+            if(link != nullptr)
+                link->SetCoresState(this->linksState.at(a * numNodes + b));
+        }
+    }
+
+    for(unsigned int a = 0; a < this->regeneratorsState.size(); a++){
+        node = dynamic_cast<NodeDevices*>(topology->GetNode(a));
+        node->SetRegeneratorsState(this->regeneratorsState.at(a));
+        node->SetTranspondersState(this->transpondersState.at(a));
+    }
+
+    this->simulType->GetCallGenerator()->SetActiveCalls(this->simulationTime,
+                                                        this->activeCalls);
+
+    //Other generation options use independent sequences in each run.
+    if(this->simulType->GetOptions()->GetGenerationOption() == GenerationSame)
+        randomStreams->SetEngines(this->engines);
+}
+
+void NetworkSnapshot::Clear() {
+    this->saved = false;
+    this->linksState.clear();
+    this->regeneratorsState.clear();
+    this->transpondersState.clear();
+    this->activeCalls.clear();
+    this->engines.clear();
+}
+
+bool NetworkSnapshot::IsSaved() const {
+    return saved;
+}
+
+bool NetworkSnapshot::IsValid() const {
+    Topology* topology = this->simulType->GetTopology();
+    NodeDevices* node;
+    
+    if(!this->saved || this->networkLoad != 
+    this->simulType->GetCallGenerator()->GetNetworkLoad() || 
+    this->runIndex != this->simulType->GetRunIndex())
+        return false;
+    
+    for(unsigned int a = 0; a < this->regeneratorsState.size(); a++){
+        node = dynamic_cast<NodeDevices*>(topology->GetNode(a));
+        
+        if(this->regeneratorsState.at(a).size() != node->GetNumRegenerator() 
+        || this->transpondersState.at(a).size() != node->GetNumTransponder())
+            return false;
+    }
+    
+    return true;
+}
+
+double NetworkSnapshot::GetNetworkLoad() const {
+    return networkLoad;
+}
+
+unsigned int NetworkSnapshot::GetNumActiveCalls() const {
+    return activeCalls.size();
+}
@@ -28,6 +28,11 @@ TypeSimulation typeSimulation)
 
 }
 
+SimulationGA::SimulationGA(const SimulationGA& orig)
+:SimulationType(orig), gaAlgorithm(nullptr) {
+    
+}
+
 SimulationGA::~SimulationGA() {
 
 }
@@ -74,7 +79,9 @@ void SimulationGA::LoadFile() {
 
 void SimulationGA::AdditionalSettings() {
     SimulationType::AdditionalSettings();
-    this->gaAlgorithm->Initialize();
+    
+    if(!this->IsCopy())
+        this->gaAlgorithm->Initialize();
 }
 
 void SimulationGA::Print() {
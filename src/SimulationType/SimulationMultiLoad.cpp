@@ -11,13 +11,21 @@
  * Created on July 31, 2019, 2:13 PM
  */
 
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <boost/make_unique.hpp>
+
 #include "../../include/SimulationType/SimulationMultiLoad.h"
 #include "../../include/Data/Parameters.h"
+#include "../../include/Data/Options.h"
 #include "../../include/Data/Data.h"
 #include "../../include/Data/InputOutput.h"
 #include "../../include/Calls/EventGenerator.h"
 #include "../../include/Calls/Traffic.h"
 #include "../../include/Structure/Topology.h"
+#include "../../include/GeneralClasses/RandomStreams.h"
 
 SimulationMultiLoad::SimulationMultiLoad(unsigned int simulIndex, 
 TypeSimulation typeSimulation)
@@ -25,6 +33,11 @@ TypeSimulation typeSimulation)
 
 }
 
+SimulationMultiLoad::SimulationMultiLoad(const SimulationMultiLoad& orig)
+:SimulationType(orig) {
+    
+}
+
 SimulationMultiLoad::~SimulationMultiLoad() {
 
 }
@@ -32,13 +45,27 @@ SimulationMultiLoad::~SimulationMultiLoad() {
 void SimulationMultiLoad::Run() {
     unsigned int numLoadPoints = this->GetParameters()->
     GetNumberLoadPoints();
+    bool seedPerPoint = (this->GetOptions()->GetGenerationOption() == 
+                         GenerationPseudoRandom);
+    
+    if(this->GetOptions()->GetExecutionOption() == ExecutionParallel ||
+    this->GetParameters()->GetNumberReplications() > 1){
+        this->RunReplications();
+        return;
+    }
     
     for(unsigned int a = 0; a < numLoadPoints; ++a){
         double loadPoint = this->GetParameters()->GetLoadPoint(a);
         this->GetData()->SetActualIndex(a);
+        this->SetRunIndex(a);
         this->GetCallGenerator()->SetNetworkLoad(loadPoint);
         this->GetInputOutput()->PrintProgressBar(a, numLoadPoints);
         
+        //Each point has its own sequence, as in the replications, so the
+        //results do not depend on the execution option.
+        if(seedPerPoint)
+            this->GetRandomStreams()->RestartSimulStreams(a);
+        
         this->RunBase();
         
         std::cout << this->GetData() << std::endl;
@@ -66,6 +93,9 @@ void SimulationMultiLoad::Print() {
 
 void SimulationMultiLoad::Save() {
     SimulationType::Save();
+    //The result files are written first, so they do not depend on the 
+    //legacy writers.
+    this->GetData()->SaveResults();
     this->GetData()->SaveLog();
     this->GetData()->SaveBP();
     this->GetData()->SaveNetUtiliz();
@@ -81,6 +111,103 @@ void SimulationMultiLoad::Save() {
     this->GetData()->SaveNumHopsRoutes();
 }
 
+void SimulationMultiLoad::RunReplications() {
+    unsigned int numLoadPoints = this->GetParameters()->
+    GetNumberLoadPoints();
+    unsigned int numReplications = this->GetParameters()->
+    GetNumberReplications();
+    double precision = this->GetParameters()->GetReplicationsPrecision();
+    unsigned int numRuns = numLoadPoints * numReplications;
+    unsigned int numThreads = 1;
+    bool seedPerPoint = (this->GetOptions()->GetGenerationOption() == 
+                         GenerationPseudoRandom);
+    std::vector<std::unique_ptr<SimulationMultiLoad>> simulCopies;
+    std::vector<std::thread> threads;
+    std::vector<unsigned int> numStartedRuns(numLoadPoints, 0);
+    unsigned int nextPoint = 0;
+    unsigned int numFinishedRuns = 0;
+    std::mutex dataMutex;
+    
+    if(this->GetOptions()->GetExecutionOption() == ExecutionParallel)
+        numThreads = std::min(numRuns, 
+        std::max(1U, std::thread::hardware_concurrency()));
+    
+    //The copies are loaded one at a time, since some offline settings
+    //change the parameters shared with this simulation.
+    for(unsigned int a = 0; a < numThreads; ++a){
+        simulCopies.push_back(boost::make_unique<SimulationMultiLoad>(*this));
+        simulCopies.back()->LoadCopy();
+    }
+    this->GetInputOutput()->PrintProgressBar(0, numRuns);
+    
+    for(auto& it: simulCopies){
+        SimulationMultiLoad* simulCopy = it.get();
+        
+        threads.push_back(std::thread([&, simulCopy](){
+            unsigned int point, replication;
+            
+            while(true){
+                {
+                    std::lock_guard<std::mutex> lock(dataMutex);
+                    
+                    while(nextPoint < numLoadPoints && 
+                    numStartedRuns.at(nextPoint) == numReplications)
+                        nextPoint++;
+                    if(nextPoint == numLoadPoints)
+                        break;
+                    point = nextPoint;
+                    replication = numStartedRuns.at(point)++;
+                }
+                
+                simulCopy->GetData()->SetActualIndex(point);
+                simulCopy->GetData()->ClearPoint(point);
+                simulCopy->GetCallGenerator()->SetNetworkLoad(
+                this->GetParameters()->GetLoadPoint(point));
+                simulCopy->GetRandomStreams()->SetReplication(replication);
+                //Each run warms up on its own, so the replications are
+                //independent and do not depend on the thread of each run.
+                simulCopy->SetRunIndex(point * numReplications + replication);
+                
+                //Each point has its own sequence, independent of the thread
+                //that simulates it.
+                if(seedPerPoint)
+                    simulCopy->GetRandomStreams()->RestartSimulStreams(point);
+                
+                simulCopy->RunBase();
+                
+                std::lock_guard<std::mutex> lock(dataMutex);
+                this->GetData()->SetActualIndex(point);
+                
+                if(replication == 0)
+                    this->GetData()->CopyPoint(simulCopy->GetData(), point);
+                if(numReplications > 1)
+                    this->GetData()->AddReplication(simulCopy->GetData(), 
+                                                    replication);
+                numFinishedRuns++;
+                
+                //The replications not started are skipped once the point 
+                //converges.
+                if(numStartedRuns.at(point) < numReplications && 
+                this->GetData()->IsReplicConverged(precision)){
+                    numFinishedRuns += numReplications - 
+                                       numStartedRuns.at(point);
+                    numStartedRuns.at(point) = numReplications;
+                }
+                this->GetInputOutput()->PrintProgressBar(numFinishedRuns, 
+                                                         numRuns);
+            }
+        }));
+    }
+    
+    for(auto& it: threads)
+        it.join();
+    
+    for(unsigned int a = 0; a < numLoadPoints; ++a){
+        this->GetData()->SetActualIndex(a);
+        std::cout << this->GetData() << std::endl;
+    }
+}
+
 std::ostream& SimulationMultiLoad::Help(std::ostream& ostream) {
     ostream << "MULTIPLE LOADS SIMULATION" << std::endl
             << "This type of simulation varies the network load "
@@ -23,23 +23,48 @@
 #include "../../include/Calls/Event.h"
 #include "../../include/ResourceAllocation/ResourceAlloc.h"
 #include "../../include/ResourceAllocation/ResourceDeviceAlloc.h"
+#include "../../include/GeneralClasses/RandomStreams.h"
+#include "../../include/SimulationType/NetworkSnapshot.h"
+#include "../../include/Data/SteadyState.h"
 
 SimulationType::SimulationType(SimulIndex simulIndex, 
 TypeSimulation typeSimulation)
-:typeSimulation(typeSimulation), simulationIndex(simulIndex),
+:numberRequests(0), typeSimulation(typeSimulation), 
+simulationIndex(simulIndex), isCopy(false), 
 parameters(std::make_shared<Parameters> (this)),
 options(std::make_shared<Options> (this)), 
 data(boost::make_unique<Data>(this)),
 topology(std::make_shared<Topology>(this)),
-inputOutput(boost::make_unique<InputOutput>(this)),
+inputOutput(std::make_shared<InputOutput>(this)),
 traffic(std::make_shared<Traffic>(this)),
 callGenerator(std::make_shared<EventGenerator>(this)),
 resourceAlloc(nullptr),
-numberRequests(0) {
+randomStreams(std::make_shared<RandomStreams>(this)),
+snapshot(std::make_shared<NetworkSnapshot>(this)),
+steadyState(std::make_shared<SteadyState>(this)), statsStartTime(0.0),
+runIndex(0) {
+    
+}
+
+SimulationType::SimulationType(const SimulationType& orig)
+:numberRequests(0), typeSimulation(orig.typeSimulation), 
+simulationIndex(orig.simulationIndex), isCopy(true), 
+parameters(orig.parameters), options(orig.options),
+data(boost::make_unique<Data>(this)),
+topology(std::make_shared<Topology>(this)),
+inputOutput(orig.inputOutput), traffic(orig.traffic),
+callGenerator(std::make_shared<EventGenerator>(this)),
+resourceAlloc(nullptr),
+randomStreams(std::make_shared<RandomStreams>(this)),
+snapshot(std::make_shared<NetworkSnapshot>(this)),
+steadyState(std::make_shared<SteadyState>(this)), statsStartTime(0.0),
+runIndex(0) {
     
 }
 
 SimulationType::~SimulationType() {
+    this->steadyState.reset();
+    this->snapshot.reset();
     this->parameters.reset();
     this->options.reset();
     this->data.reset();
@@ -48,9 +73,15 @@ SimulationType::~SimulationType() {
     this->traffic.reset();
     this->callGenerator.reset();
     this->resourceAlloc.reset();
+    this->randomStreams.reset();
 }
 
 void SimulationType::Run() {
+    
+    if(this->parameters->GetNumberWarmUpReq() > 0.0 && 
+    !this->snapshot->IsValid())
+        this->WarmUp();
+    
     this->InitializeAll();
     this->Simulate();
     this->FinalizeAll();
@@ -59,6 +90,7 @@ void SimulationType::Run() {
 void SimulationType::Load() {
     this->parameters->Load();
     this->options->Load();
+    this->randomStreams->Load();
     this->topology->LoadFile();
     this->traffic->LoadFile();
     this->GetData()->Initialize();
@@ -69,6 +101,7 @@ void SimulationType::Load() {
 void SimulationType::LoadFile() {
     this->parameters->LoadFile();
     this->options->LoadFile();
+    this->randomStreams->Load();
     this->topology->LoadFile();
     this->traffic->LoadFile();
     this->GetData()->Initialize();
@@ -76,6 +109,17 @@ void SimulationType::LoadFile() {
     this->callGenerator->Load();
 }
 
+void SimulationType::LoadCopy() {
+    assert(this->isCopy);
+    
+    this->randomStreams->Load();
+    this->topology->LoadFile();
+    this->GetData()->Initialize();
+    this->CreateLoadResourceAlloc();
+    this->callGenerator->Load();
+    this->AdditionalSettings();
+}
+
 void SimulationType::Print() {
     std::cout << this->options << std::endl;
     std::cout << this->parameters << std::endl;
@@ -91,6 +135,7 @@ void SimulationType::Save() {
 void SimulationType::AdditionalSettings() {
     this->topology->SetAditionalSettings();
     this->resourceAlloc->AdditionalSettings();
+    this->resourceAlloc->SaveResourcesCache();
 }
 
 TypeSimulation SimulationType::GetTypeSimulation() const {
@@ -133,13 +178,54 @@ ResourceAlloc* SimulationType::GetResourceAlloc() const {
     return this->resourceAlloc.get();
 }
 
+RandomStreams* SimulationType::GetRandomStreams() const {
+    return randomStreams.get();
+}
+
+NetworkSnapshot* SimulationType::GetSnapshot() const {
+    return snapshot.get();
+}
+
+bool SimulationType::IsCopy() const {
+    return isCopy;
+}
+
+unsigned int SimulationType::GetRunIndex() const {
+    return runIndex;
+}
+
+void SimulationType::SetRunIndex(unsigned int runIndex) {
+    this->runIndex = runIndex;
+}
+
 void SimulationType::InitializeAll() {
     this->topology->Initialize();
     this->callGenerator->Initialize();
+    
+    if(this->snapshot->IsSaved())
+        this->snapshot->Restore();
     this->numberRequests = 0.0;
 }
 
+void SimulationType::WarmUp() {
+    double numWarmUpReq = this->parameters->GetNumberWarmUpReq();
+    
+    this->snapshot->Clear();
+    this->InitializeAll();
+    this->callGenerator->GenerateCall();
+    
+    while(this->numberRequests < numWarmUpReq)
+        this->callGenerator->GetNextEvent()->ImplementEvent();
+    
+    this->snapshot->Save();
+    //The trace stays open, so it holds the warm-up and the run.
+    this->callGenerator->FinalizeWarmUp();
+    this->GetData()->ClearPoint(this->GetData()->GetActualIndex());
+}
+
 void SimulationType::Simulate() {
+    this->statsStartTime = this->callGenerator->GetSimulationTime();
+    this->steadyState->Initialize();
     this->callGenerator->GenerateCall();
     
     switch(options->GetStopCriteria()){
@@ -149,13 +235,17 @@ void SimulationType::Simulate() {
         case NumCallRequestsBlocked:
             this->SimulateNumBlocReq();
             break;
+        case BlockingConverged:
+            this->SimulateBlocConverged();
+            break;
         default:
             std::cerr << "Invalid stop criteria" << std::endl;
             std::abort();
     }
     
     this->GetData()->SetNumberReq(this->numberRequests);
-    this->GetData()->SetSimulTime(this->callGenerator->GetSimulationTime());
+    this->GetData()->SetSimulTime(this->callGenerator->GetSimulationTime() -
+                                  this->statsStartTime);
     this->GetData()->SetLinksUse(this->GetTopology());
 }
 
@@ -176,7 +266,7 @@ void SimulationType::CreateLoadResourceAlloc() {
 
 void SimulationType::SimulateNumTotalReq() {
     double numReqMax = this->parameters->GetNumberReqMax();
-    std::shared_ptr<Event> evt;
+    Event* evt;
     unsigned int countEvent = 0;
     double countBand = 1E8;
     FragMeasureOption fragOption = options->GetFragMeasureOption();
@@ -187,6 +277,9 @@ void SimulationType::SimulateNumTotalReq() {
         countEvent++;
                
         evt->ImplementEvent();
+        
+        if(this->CheckTransient())
+            countBand = 1E8;
             
         if(fragOption != FragMetricDisabled && countEvent == 100){
             this->GetData()->UpdateFragmentationRatio(
@@ -205,7 +298,7 @@ void SimulationType::SimulateNumTotalReq() {
 
 void SimulationType::SimulateNumBlocReq() {
     double numBlocReqMax = this->parameters->GetNumberBloqMax();
-    std::shared_ptr<Event> evt;
+    Event* evt;
     unsigned int countEvent = 0;
     FragMeasureOption fragOption = options->GetFragMeasureOption();
     
@@ -214,6 +307,7 @@ void SimulationType::SimulateNumBlocReq() {
         countEvent++;
         
         evt->ImplementEvent();
+        this->CheckTransient();
         
         if(countEvent == 1000 && fragOption != FragMetricDisabled){
             this->GetData()->UpdateFragmentationRatio(
@@ -222,3 +316,38 @@ void SimulationType::SimulateNumBlocReq() {
         }
     }
 }
+
+void SimulationType::SimulateBlocConverged() {
+    double numReqMax = this->parameters->GetNumberReqMax();
+    Event* evt;
+    unsigned int countEvent = 0;
+    FragMeasureOption fragOption = options->GetFragMeasureOption();
+    
+    while(this->numberRequests < numReqMax && 
+    !this->steadyState->IsConverged()){
+        evt = this->callGenerator->GetNextEvent();
+        countEvent++;
+        
+        evt->ImplementEvent();
+        this->CheckTransient();
+        
+        if(countEvent == 1000 && fragOption != FragMetricDisabled){
+            this->GetData()->UpdateFragmentationRatio(
+            resourceAlloc->CalcNetworkFragmentation());
+            countEvent = 0;
+        }
+    }
+}
+
+bool SimulationType::CheckTransient() {
+    
+    if(!this->steadyState->Update())
+        return false;
+    
+    this->GetData()->ClearPoint(this->GetData()->GetActualIndex());
+    this->numberRequests = 0.0;
+    this->statsStartTime = this->callGenerator->GetSimulationTime();
+    this->steadyState->Restart();
+    
+    return true;
+}
@@ -12,6 +12,7 @@
  */
 
 #include "../../include/Structure/Core.h"
+#include "../../include/Structure/Topology.h"
 
 std::ostream& operator<<(std::ostream& ostream,
 Core* core) {
@@ -21,8 +22,11 @@ Core* core) {
 }
 
 Core::Core(Link* link, CoreIndex coreId, unsigned int numSlots)
-:link(link), coreId(coreId), slotsStatus(0), coreState(working) {
-    slotsStatus.assign(numSlots, free);
+:link(link), coreId(coreId), freeSlots(numSlots, true), 
+reservedSlots(numSlots, false), reutilizedSlots(numSlots, false), 
+numFreeBlocks(0), numFreeSlots(0), largestFreeBlock(0), numSimultAloc(0),
+coreState(working) {
+    this->Initialize();
 }
 
 Core::~Core() {
@@ -30,7 +34,15 @@ Core::~Core() {
 }
 
 void Core::Initialize() {
-    slotsStatus.assign(slotsStatus.size(), free);
+    freeSlots.Assign(true);
+    reservedSlots.Assign(false);
+    reutilizedSlots.Assign(false);
+    
+    numFreeBlocks.assign(freeSlots.GetNumSlots() + 1, 0);
+    numFreeSlots = freeSlots.GetNumSlots();
+    largestFreeBlock = 0;
+    numSimultAloc = 0;
+    this->AddFreeBlock(numFreeSlots);
 }
 
 CoreIndex Core::GetCoreId(){
@@ -38,26 +50,18 @@ CoreIndex Core::GetCoreId(){
 }
 
 bool Core::IsSlotOccupied(SlotIndex sPosition){
+    assert(sPosition < freeSlots.GetNumSlots());
     
-    if(slotsStatus.at(sPosition) == occupied || slotsStatus.at(sPosition) == reserved || slotsStatus.at(sPosition) == reutilized)
-        return true;
-    return false;
+    return !freeSlots.Test(sPosition);
 }
 
 bool Core::IsSlotOccupied(SlotIndex sPosition, SlotState type){
+    assert(sPosition < freeSlots.GetNumSlots());
 
     if(type == occupied || type == reserved){
-        if(slotsStatus.at(sPosition) == free){
-            return false;
-        }else{
-            return true;
-        }
+        return !freeSlots.Test(sPosition);
     }else if(type == reutilized){
-        if(slotsStatus.at(sPosition) == reserved){
-            return false;
-        }else{
-            return true;
-        }
+        return !reservedSlots.Test(sPosition);
     }else{
         return false;
     }
@@ -71,43 +75,60 @@ bool Core::IsSlotFree(SlotIndex sPosition, SlotState state) {
     return !this->IsSlotOccupied(sPosition, state);
 }
 
+bool Core::IsSlotsFree(SlotIndex firstSlot, SlotIndex lastSlot, 
+SlotState type) const {
+    
+    if(type == occupied || type == reserved){
+        return freeSlots.Test(firstSlot, lastSlot);
+    }else if(type == reutilized){
+        return reservedSlots.Test(firstSlot, lastSlot);
+    }else{
+        return true;
+    }
+}
+
 void Core::OccupySlot(SlotIndex sPosition){
-    assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == free);
+    assert(sPosition < freeSlots.GetNumSlots() && freeSlots.Test(sPosition));
     
-    slotsStatus.at(sPosition) = occupied;
+    this->ResetSlotFree(sPosition);
 }
 
 void Core::OccupySlot(SlotIndex sPosition, SlotState state){
     if(state == occupied){
-        assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == free);
-        slotsStatus.at(sPosition) = occupied;
+        assert(sPosition < freeSlots.GetNumSlots() && 
+               freeSlots.Test(sPosition));
+        this->ResetSlotFree(sPosition);
     }else if(state == reserved){
-        assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == free);
-        slotsStatus.at(sPosition) = reserved;
+        assert(sPosition < freeSlots.GetNumSlots() && 
+               freeSlots.Test(sPosition));
+        this->ResetSlotFree(sPosition);
+        reservedSlots.Set(sPosition);
     }else if(state == reutilized){
-        if(slotsStatus.at(sPosition) == reserved){
-            assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == reserved);
-            slotsStatus.at(sPosition) = reutilized;
+        if(reservedSlots.Test(sPosition)){
+            reservedSlots.Reset(sPosition);
+            reutilizedSlots.Set(sPosition);
         }
     }
 }
 
 void Core::ReleaseSlot(SlotIndex sPosition, bool typeCall) {
-
-    if(slotsStatus.at(sPosition) == occupied){
-        assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == occupied);
-        slotsStatus.at(sPosition) = free;
-    }else if(slotsStatus.at(sPosition) == reserved){
-        assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == reserved);
-        slotsStatus.at(sPosition) = free;
-    }else if(slotsStatus.at(sPosition) == reutilized){
-        assert(sPosition < slotsStatus.size() && slotsStatus.at(sPosition) == reutilized);
-        if(typeCall == true){
-            slotsStatus.at(sPosition) = occupied;
-        }else{
-            slotsStatus.at(sPosition) = reserved;
-        }
-
+    
+    switch(this->GetSlotStatus(sPosition)){
+        case occupied:
+            this->SetSlotFree(sPosition);
+            break;
+        case reserved:
+            reservedSlots.Reset(sPosition);
+            this->SetSlotFree(sPosition);
+            break;
+        case reutilized:
+            reutilizedSlots.Reset(sPosition);
+            
+            if(typeCall == false)
+                reservedSlots.Set(sPosition);
+            break;
+        default:
+            break;
     }
 }
 
@@ -120,9 +141,112 @@ void Core::SetCoreState(State state) {
 }
 
 unsigned int Core::GetNumSlots() {
-    return slotsStatus.size();
+    return freeSlots.GetNumSlots();
 }
 
 std::vector<SlotState> Core::GetSlotsStatus() const {
+    unsigned int numSlots = freeSlots.GetNumSlots();
+    std::vector<SlotState> slotsStatus(numSlots, occupied);
+    
+    for(SlotIndex a = 0; a < numSlots; a++)
+        slotsStatus[a] = this->GetSlotStatus(a);
+    
     return slotsStatus;
 }
+
+SlotState Core::GetSlotStatus(SlotIndex sPosition) const {
+    
+    if(freeSlots.Test(sPosition))
+        return free;
+    if(reservedSlots.Test(sPosition))
+        return reserved;
+    if(reutilizedSlots.Test(sPosition))
+        return reutilized;
+    
+    return occupied;
+}
+
+const SlotMask& Core::GetFreeSlots() const {
+    return freeSlots;
+}
+
+const SlotMask& Core::GetReservedSlots() const {
+    return reservedSlots;
+}
+
+const SlotMask& Core::GetReutilizedSlots() const {
+    return reutilizedSlots;
+}
+
+const SlotMask& Core::GetAvailableSlots(SlotState type) const {
+    
+    switch(type){
+        case occupied:
+        case reserved:
+            return freeSlots;
+        case reutilized:
+            return reservedSlots;
+        default:
+            std::cerr << "Invalid slot state" << std::endl;
+            std::abort();
+    }
+}
+
+unsigned int Core::GetNumFreeSlots() const {
+    return numFreeSlots;
+}
+
+unsigned int Core::GetLargestFreeBlock() const {
+    return largestFreeBlock;
+}
+
+unsigned int Core::GetNumSimultAloc() const {
+    return numSimultAloc;
+}
+
+void Core::SetSlotFree(SlotIndex sPosition) {
+    unsigned int sizeBefore = freeSlots.CountSetBefore(sPosition);
+    unsigned int sizeAfter = freeSlots.CountSetAfter(sPosition);
+    
+    this->RemoveFreeBlock(sizeBefore);
+    this->RemoveFreeBlock(sizeAfter);
+    this->AddFreeBlock(sizeBefore + 1 + sizeAfter);
+    freeSlots.Set(sPosition);
+    numFreeSlots++;
+}
+
+void Core::ResetSlotFree(SlotIndex sPosition) {
+    unsigned int sizeBefore = freeSlots.CountSetBefore(sPosition);
+    unsigned int sizeAfter = freeSlots.CountSetAfter(sPosition);
+    
+    this->RemoveFreeBlock(sizeBefore + 1 + sizeAfter);
+    this->AddFreeBlock(sizeBefore);
+    this->AddFreeBlock(sizeAfter);
+    freeSlots.Reset(sPosition);
+    numFreeSlots--;
+}
+
+void Core::AddFreeBlock(unsigned int blockSize) {
+    
+    if(blockSize == 0)
+        return;
+    
+    numFreeBlocks[blockSize]++;
+    numSimultAloc += link->GetTopology()->GetNumSimultAloc(blockSize);
+    
+    if(blockSize > largestFreeBlock)
+        largestFreeBlock = blockSize;
+}
+
+void Core::RemoveFreeBlock(unsigned int blockSize) {
+    
+    if(blockSize == 0)
+        return;
+    
+    assert(numFreeBlocks[blockSize] > 0);
+    numFreeBlocks[blockSize]--;
+    numSimultAloc -= link->GetTopology()->GetNumSimultAloc(blockSize);
+    
+    while(largestFreeBlock > 0 && numFreeBlocks[largestFreeBlock] == 0)
+        largestFreeBlock--;
+}
@@ -41,7 +41,7 @@ void Regenerator::SetRegeneratorOn() {
     this->isActive = true;
     this->onTime = topology->GetSimulType()->GetCallGenerator()->
                    GetSimulationTime();
-    node->DecreaseNumFreeRegenerators();
+    node->OccupyRegenerator(this);
 }
 
 void Regenerator::SetRegeneratorOff() {
@@ -51,7 +51,7 @@ void Regenerator::SetRegeneratorOff() {
     this->totalOnTime += topology->GetSimulType()->
                          GetCallGenerator()->GetSimulationTime() - this->onTime;
     this->onTime = 0.0;
-    node->IncreaseNumFreeRegenerators();
+    node->ReleaseRegenerator(this);
 }
 
 bool Regenerator::IsActive() const {
@@ -12,12 +12,14 @@
  */
 
 #include "../../../include/Structure/Devices/SBVT_TSS_ML.h"
+#include "../../../include/Structure/NodeDevices.h"
 #include "../../../include/Calls/CallDevices.h"
 
 unsigned int SBVT_TSS_ML::numSubCarriers = 4;
 
 SBVT_TSS_ML::SBVT_TSS_ML(Topology* topology, NodeDevices* node)
-:BVT(topology, node, TypeBVT_TSS_ML), subCarriers(0), modulations(0), calls(0) {
+:BVT(topology, node, TypeBVT_TSS_ML), subCarriers(0), modulations(0), calls(0),
+numFreeSubCarriers(0) {
     
 }
 
@@ -30,17 +32,10 @@ void SBVT_TSS_ML::Initialize() {
     subCarriers.assign(numSubCarriers, free);
     modulations.assign(numSubCarriers, InvalidModulation);
     calls.assign(numSubCarriers, nullptr);
+    numFreeSubCarriers = numSubCarriers;
 }
 
 unsigned int SBVT_TSS_ML::GetNumberFreeSubCarriers() const {
-    unsigned int numFreeSubCarriers = 0;
-    
-    for(auto it: subCarriers){
-        
-        if(it == free)
-            numFreeSubCarriers++;
-    }
-    
     return numFreeSubCarriers;
 }
 
@@ -64,23 +59,33 @@ unsigned int numSubCarriers) {
 
 void SBVT_TSS_ML::ConnectSubCarriers(CallDevices* call) {
     unsigned int numCarriers = 0;
+    unsigned int numOccupied = 0;
     
     for(unsigned ind = 0; ind < calls.size(); ind++){
         
         if(calls.at(ind) == call){
+            
+            if(subCarriers.at(ind) == free)
+                numOccupied++;
             subCarriers.at(ind) = occupied;
             numCarriers++;
         }
     }
     assert(numCarriers > 0);
+    numFreeSubCarriers -= numOccupied;
+    node->UpdateFreeSubCarriers(this, numOccupied, true);
 }
 
 void SBVT_TSS_ML::ReleaseSubCarriers(CallDevices* call) {
     unsigned int numCarriers = 0;
+    unsigned int numReleased = 0;
     
     for(unsigned ind = 0; ind < calls.size(); ind++){
         
         if(calls.at(ind) == call){
+            
+            if(subCarriers.at(ind) == occupied)
+                numReleased++;
             subCarriers.at(ind) = free;
             modulations.at(ind) = InvalidModulation;
             calls.at(ind) = nullptr;
@@ -88,4 +93,6 @@ void SBVT_TSS_ML::ReleaseSubCarriers(CallDevices* call) {
         }
     }
     assert(numCarriers > 0);
+    numFreeSubCarriers += numReleased;
+    node->UpdateFreeSubCarriers(this, numReleased, false);
 }
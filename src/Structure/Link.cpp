@@ -40,8 +40,11 @@ NodeIndex destinationNode, double length, unsigned int numberSections,
 unsigned int numberCores, unsigned int numberSlots)
 :topPointer(topPointer), origimNode(origimNode), 
 destinationNode(destinationNode), length(length), 
-numberSections(numberSections), cost(0.0), cores(0), linkState(working), 
-utilization(0), use(0) {
+numberSections(numberSections), 
+sectionLoss(1.0/General::dBToLinear(length/numberSections*Signal::Alpha)),
+sectionGain(1.0/sectionLoss), 
+sectionAsePower(Signal::pASE(Signal::fn, sectionGain)), cost(0.0), 
+cores(0), linkState(working), utilization(0), use(0) {
     
     for(unsigned int a = 0; a < numberCores; a++)
         cores.push_back(std::make_shared<Core>(this, a, numberSlots));
@@ -124,20 +127,16 @@ void Link::CalcSignal(Signal* signal) const {
     double asePower = signal->GetAsePower();
     double nonLinearPower = signal->GetNonLinearPower();
     
-    double lSec = (double) this->GetLength()/this->GetNumberSections();
-    double gLSec = 1.0/(General::dBToLinear(lSec*Signal::Alpha));
-    double gAmp = 1.0/gLSec;
-    
     for(unsigned int sec = 0; sec < this->numberSections; sec++){
-        signalPower *= gLSec;
-        asePower *= gLSec;
-        nonLinearPower *= gLSec;
+        signalPower *= this->sectionLoss;
+        asePower *= this->sectionLoss;
+        nonLinearPower *= this->sectionLoss;
         nonLinearPower += 0.0;
         
-        signalPower *= gAmp;
-        asePower *= gAmp;
-        asePower += Signal::pASE(Signal::fn, gAmp);
-        nonLinearPower *= gAmp;
+        signalPower *= this->sectionGain;
+        asePower *= this->sectionGain;
+        asePower += this->sectionAsePower;
+        nonLinearPower *= this->sectionGain;
     }
     
     signal->SetSignalPower(signalPower);
@@ -211,28 +210,21 @@ unsigned int Link::GetNumSlots(const CoreIndex coreId) const {
 }
 
 unsigned int Link::GetNumberFreeSlots() const {
-    unsigned int numFreeSlots = 0;
-    unsigned int numSlots = cores.front()->GetNumSlots();
-    
-    for(unsigned int a = 0; a < numSlots; a++){
-        if(cores.front()->IsSlotFree(a))
-            numFreeSlots++;
-    }
-    
-    return numFreeSlots;
+    return cores.front()->GetNumFreeSlots();
 }
 
 unsigned int Link::GetNumberFreeSlots(const CoreIndex coreId) const {
     assert(coreId < cores.size());
-    unsigned int numFreeSlots = 0;
-    unsigned int numSlots = cores.at(coreId)->GetNumSlots();
-    
-    for(unsigned int a = 0; a < numSlots; a++){
-        if(cores.at(coreId)->IsSlotFree(a))
-            numFreeSlots++;
-    }
     
-    return numFreeSlots;
+    return cores.at(coreId)->GetNumFreeSlots();
+}
+
+unsigned int Link::GetLargestFreeBlock() const {
+    return cores.front()->GetLargestFreeBlock();
+}
+
+unsigned int Link::GetNumSimultAloc() const {
+    return cores.front()->GetNumSimultAloc();
 }
 
 unsigned int Link::GetNumberOccupiedSlots() const {
@@ -247,7 +239,7 @@ unsigned int Link::GetNumberOccupiedSlots(const CoreIndex coreId) const {
     assert(coreId < cores.size());
     unsigned int numOccupiedSlots = 0;
     unsigned int numSlots = cores.at(coreId)->GetNumSlots();
-    numOccupiedSlots = numSlots - this->GetNumberFreeSlots();
+    numOccupiedSlots = numSlots - this->GetNumberFreeSlots(coreId);
     
     return numOccupiedSlots;
 }
@@ -260,6 +252,43 @@ std::vector<SlotState> Link::GetVecDisp(const CoreIndex coreId) const {
     return cores.at(coreId)->GetSlotsStatus();
 }
 
+std::vector<Core> Link::GetCoresState() const {
+    std::vector<Core> coresState;
+    coresState.reserve(cores.size());
+    
+    for(auto it: cores)
+        coresState.push_back(*it);
+    
+    return coresState;
+}
+
+void Link::SetCoresState(const std::vector<Core>& coresState) {
+    assert(coresState.size() == cores.size());
+    
+    for(unsigned int a = 0; a < cores.size(); a++)
+        *cores[a] = coresState[a];
+}
+
+const SlotMask& Link::GetFreeSlots(const CoreIndex coreId) const {
+    assert(coreId < cores.size());
+    
+    return cores[coreId]->GetFreeSlots();
+}
+
+const SlotMask& Link::GetAvailableSlots(const CoreIndex coreId, 
+SlotState type) const {
+    assert(coreId < cores.size());
+    
+    return cores[coreId]->GetAvailableSlots(type);
+}
+
+bool Link::IsSlotsFree(const CoreIndex coreId, const SlotIndex firstSlot, 
+const SlotIndex lastSlot, SlotState type) const {
+    assert(coreId < cores.size());
+    
+    return cores[coreId]->IsSlotsFree(firstSlot, lastSlot, type);
+}
+
 Topology* Link::GetTopology() const {
     return this->topPointer;
 }
@@ -11,14 +11,17 @@
  * Created on April 29, 2019, 3:08 PM
  */
 
+#include <algorithm>
+
 #include "../../include/Structure/NodeDevices.h"
 #include "../../include/Structure/Devices/Regenerator.h"
 #include "../../include/Structure/Devices/SBVT_TSS_ML.h"
 #include "../../include/Calls/CallDevices.h"
 
 NodeDevices::NodeDevices(Topology* topPointer, NodeIndex nodeId)
-:Node(topPointer, nodeId), numRegenerator(0), numFreeRegenerators(0),
-regenerators(0), numTransponder(0), transponders(0) {
+:Node(topPointer, nodeId), numRegenerator(0), regenerators(), 
+freeRegenerators(), numTransponder(0), transponders(), freeTransponders(),
+numFreeSubCarriers(0) {
     
 }
 
@@ -45,46 +48,39 @@ void NodeDevices::SetNumRegenerator(unsigned int numRegenerator) {
 }
 
 unsigned int NodeDevices::GetNumFreeRegenerators() const {
-    return numFreeRegenerators;
+    return freeRegenerators.GetSize();
 }
 
 unsigned int NodeDevices::GetNumOccRegenerators() const {
-    return (numRegenerator - numFreeRegenerators);
+    return (numRegenerator - freeRegenerators.GetSize());
 }
 
-void NodeDevices::IncreaseNumFreeRegenerators() {
-    assert(numFreeRegenerators < numRegenerator);
-    numFreeRegenerators++;
+void NodeDevices::OccupyRegenerator(const Regenerator* regenerator) {
+    this->freeRegenerators.Remove(regenerator - this->regenerators.data());
 }
 
-void NodeDevices::DecreaseNumFreeRegenerators() {
-    assert(numFreeRegenerators > 0);
-    numFreeRegenerators--;
+void NodeDevices::ReleaseRegenerator(const Regenerator* regenerator) {
+    this->freeRegenerators.Insert(regenerator - this->regenerators.data());
 }
 
 bool NodeDevices::isThereFreeRegenerators(double bitRate) const {
     unsigned int numReg = (unsigned int) std::ceil(bitRate / 
                           Regenerator::GetTrafficSupported());
     
-    if(numReg <= numFreeRegenerators)
+    if(numReg <= freeRegenerators.GetSize())
         return true;
     return false;
 }
 
-std::vector<std::shared_ptr<Regenerator> > NodeDevices::
-GetFreeRegenenerators(double bitRate) const {
-    std::vector<std::shared_ptr<Regenerator>> vecReg(0);
+std::vector<Regenerator*> NodeDevices::GetFreeRegenenerators(double bitRate) {
+    std::vector<Regenerator*> vecReg(0);
     unsigned int numReg = (unsigned int) std::ceil(bitRate / 
                           Regenerator::GetTrafficSupported());
+    numReg = std::min(numReg, freeRegenerators.GetSize());
+    vecReg.reserve(numReg);
     
-    for(auto it: regenerators){
-        
-        if(!it->IsActive())
-            vecReg.push_back(it);
-        
-        if(vecReg.size() == numReg)
-            break;
-    }
+    for(unsigned int a = 0; a < numReg; a++)
+        vecReg.push_back(&regenerators[freeRegenerators.GetIndex(a)]);
     
     return vecReg;
 }
@@ -104,38 +100,50 @@ void NodeDevices::SetNumTransponder(unsigned int numTransponder) {
     this->numTransponder = numTransponder;
 }
 
-bool NodeDevices::isThereFreeBVT(unsigned int numSlots) const {
-    unsigned int numFreeSubcarriers = 0;
+void NodeDevices::UpdateFreeSubCarriers(const BVT* transponder, 
+unsigned int numSubCarriers, bool occupy) {
+    //All transponders are created as SBVT_TSS_ML.
+    unsigned int index = static_cast<const SBVT_TSS_ML*>(transponder) - 
+                         this->transponders.data();
+    bool isFree = transponder->GetNumberFreeSubCarriers() > 0;
     
-    for(auto it: transponders){
-        numFreeSubcarriers += it->GetNumberFreeSubCarriers();
-        
-        if(numFreeSubcarriers >= numSlots)
-            return true;
+    if(occupy){
+        assert(numSubCarriers <= this->numFreeSubCarriers);
+        this->numFreeSubCarriers -= numSubCarriers;
     }
+    else
+        this->numFreeSubCarriers += numSubCarriers;
     
-    return false;
+    if(isFree && !this->freeTransponders.Contains(index))
+        this->freeTransponders.Insert(index);
+    else if(!isFree && this->freeTransponders.Contains(index))
+        this->freeTransponders.Remove(index);
 }
 
-std::vector<std::shared_ptr<BVT> > NodeDevices::GetBVTs(CallDevices* call) 
-const {
-    std::vector<std::shared_ptr<BVT>> vecBVT(0);
+bool NodeDevices::isThereFreeBVT(unsigned int numSlots) const {
+    
+    return (!transponders.empty() && numFreeSubCarriers >= numSlots);
+}
+
+std::vector<BVT*> NodeDevices::GetBVTs(CallDevices* call) {
+    std::vector<BVT*> vecBVT(0);
     unsigned int numSlots = call->GetNumberSlots();
     unsigned int totalNumSlotsAllocated = 0;
     unsigned int auxNumFreeSubCarriers = 0;
-    
-    for(auto it: transponders){
-        auxNumFreeSubCarriers = it->GetNumberFreeSubCarriers();
+    BVT* bvt;
+    
+    //Setting the call to the subcarriers does not free or occupy them, so
+    //the pool does not change in this loop.
+    for(unsigned int a = 0; a < freeTransponders.GetSize(); a++){
+        bvt = &transponders[freeTransponders.GetIndex(a)];
+        auxNumFreeSubCarriers = bvt->GetNumberFreeSubCarriers();
+        vecBVT.push_back(bvt);
+        totalNumSlotsAllocated += auxNumFreeSubCarriers;
         
-        if(auxNumFreeSubCarriers > 0){
-            vecBVT.push_back(it);
-            totalNumSlotsAllocated += auxNumFreeSubCarriers;
-            
-            if(totalNumSlotsAllocated > numSlots){
-                auxNumFreeSubCarriers -= (totalNumSlotsAllocated - numSlots);
-            }
-            it->SetCallToSubCarriers(call, auxNumFreeSubCarriers);
+        if(totalNumSlotsAllocated > numSlots){
+            auxNumFreeSubCarriers -= (totalNumSlotsAllocated - numSlots);
         }
+        bvt->SetCallToSubCarriers(call, auxNumFreeSubCarriers);
         
         if(totalNumSlotsAllocated >= numSlots)
             break;
@@ -144,17 +152,57 @@ const {
     return vecBVT;
 }
 
+std::vector<Regenerator> NodeDevices::GetRegeneratorsState() const {
+    return regenerators;
+}
+
+void NodeDevices::SetRegeneratorsState(const std::vector<Regenerator>& 
+regeneratorsState) {
+    assert(regeneratorsState.size() == regenerators.size());
+    this->freeRegenerators.Initialize(regenerators.size(), false);
+    
+    //The assignment keeps the addresses of the regenerators used by the
+    //active calls.
+    for(unsigned int a = 0; a < regenerators.size(); a++){
+        regenerators[a] = regeneratorsState[a];
+        
+        if(!regenerators[a].IsActive())
+            this->freeRegenerators.Insert(a);
+    }
+}
+
+std::vector<SBVT_TSS_ML> NodeDevices::GetTranspondersState() const {
+    return transponders;
+}
+
+void NodeDevices::SetTranspondersState(const std::vector<SBVT_TSS_ML>& 
+transpondersState) {
+    assert(transpondersState.size() == transponders.size());
+    this->freeTransponders.Initialize(transponders.size(), false);
+    this->numFreeSubCarriers = 0;
+    
+    for(unsigned int a = 0; a < transponders.size(); a++){
+        transponders[a] = transpondersState[a];
+        
+        if(transponders[a].GetNumberFreeSubCarriers() > 0){
+            this->freeTransponders.Insert(a);
+            this->numFreeSubCarriers += 
+            transponders[a].GetNumberFreeSubCarriers();
+        }
+    }
+}
+
 void NodeDevices::InitializeRegnerators() {
-    this->numFreeRegenerators = this->numRegenerator;
     
     if(this->numRegenerator > this->regenerators.size())
         this->CreateRegenerators();
     else if(this->numRegenerator < this->regenerators.size())
         this->DeleteRegenerators();
     
-    for(auto it: this->regenerators){
-        it->Initialize();
+    for(auto& it: this->regenerators){
+        it.Initialize();
     }
+    this->freeRegenerators.Initialize(this->numRegenerator, true);
 }
 
 void NodeDevices::InitializeTransponders() {
@@ -164,39 +212,44 @@ void NodeDevices::InitializeTransponders() {
     else if(numTransponder < transponders.size())
         this->DeleteTransponders();
     
-    for(auto it: transponders){
-        it->Initialize();
+    for(auto& it: transponders){
+        it.Initialize();
     }
+    this->freeTransponders.Initialize(numTransponder, true);
+    this->numFreeSubCarriers = 0;
+    
+    for(auto& it: transponders)
+        this->numFreeSubCarriers += it.GetNumberFreeSubCarriers();
 }
 
 void NodeDevices::CreateRegenerators() {
     
+    this->regenerators.reserve(this->numRegenerator);
+    
     while(this->numRegenerator > this->regenerators.size()){
-        this->regenerators.push_back(std::make_shared<Regenerator>(
-        this->GetTopology(), this));
+        this->regenerators.emplace_back(this->GetTopology(), this);
     }
 }
 
 void NodeDevices::DeleteRegenerators() {
 
     while(this->numRegenerator < this->regenerators.size()){
-        this->regenerators.back().reset();
         this->regenerators.pop_back();
     }
 }
 
 void NodeDevices::CreateTransponders() {
     
+    transponders.reserve(numTransponder);
+    
     while(numTransponder > transponders.size()){
-        transponders.push_back(std::make_shared<SBVT_TSS_ML>(
-        this->GetTopology(), this));
+        transponders.emplace_back(this->GetTopology(), this);
     }
 }
 
 void NodeDevices::DeleteTransponders() {
     
     while(numTransponder < transponders.size()){
-        transponders.back().reset();
         transponders.pop_back();
     }
 }
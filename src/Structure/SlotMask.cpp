@@ -0,0 +1,245 @@
+/*
+ * To change this license header, choose License Headers in Project Properties.
+ * To change this template file, choose Tools | Templates
+ * and open the template in the editor.
+ */
+
+/*
+ * File:   SlotMask.cpp
+ * Author: agent
+ *
+ * Created on October 17, 2026, 2:56 PM
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "../../include/Structure/SlotMask.h"
+
+const unsigned int SlotMask::wordSize = 64;
+
+SlotMask::SlotMask()
+:numSlots(0), words(0) {
+
+}
+
+SlotMask::SlotMask(unsigned int numSlots, bool value)
+:numSlots(numSlots), words((numSlots + wordSize - 1) / wordSize, 0) {
+    this->Assign(value);
+}
+
+SlotMask::~SlotMask() {
+
+}
+
+void SlotMask::Assign(bool value) {
+    words.assign(words.size(), value ? ~Word(0) : Word(0));
+    this->ClearUnusedBits();
+}
+
+void SlotMask::Set(SlotIndex pos) {
+    this->CheckSlot(pos, "SlotMask::Set");
+
+    words[pos / wordSize] |= Word(1) << (pos % wordSize);
+}
+
+void SlotMask::Reset(SlotIndex pos) {
+    this->CheckSlot(pos, "SlotMask::Reset");
+
+    words[pos / wordSize] &= ~(Word(1) << (pos % wordSize));
+}
+
+bool SlotMask::Test(SlotIndex pos) const {
+    this->CheckSlot(pos, "SlotMask::Test");
+
+    return (words[pos / wordSize] >> (pos % wordSize)) & Word(1);
+}
+
+bool SlotMask::Test(SlotIndex firstSlot, SlotIndex lastSlot) const {
+
+    if(firstSlot > lastSlot)
+        return true;
+    this->CheckSlot(lastSlot, "SlotMask::Test");
+
+    unsigned int firstWord = firstSlot / wordSize;
+    unsigned int lastWord = lastSlot / wordSize;
+    Word firstBits = ~Word(0) << (firstSlot % wordSize);
+    Word lastBits = ~Word(0) >> (wordSize - 1 - lastSlot % wordSize);
+
+    if(firstWord == lastWord)
+        return (words[firstWord] & (firstBits & lastBits)) ==
+               (firstBits & lastBits);
+
+    if((words[firstWord] & firstBits) != firstBits)
+        return false;
+
+    for(unsigned int a = firstWord + 1; a < lastWord; a++){
+        if(words[a] != ~Word(0))
+            return false;
+    }
+
+    return (words[lastWord] & lastBits) == lastBits;
+}
+
+SlotMask& SlotMask::operator&=(const SlotMask& mask) {
+
+    if(mask.numSlots != this->numSlots)
+        throw std::invalid_argument("SlotMask::operator&=: masks with " 
+        + std::to_string(mask.numSlots) + " and " 
+        + std::to_string(this->numSlots) + " slots");
+
+    for(unsigned int a = 0; a < words.size(); a++)
+        words[a] &= mask.words[a];
+
+    return *this;
+}
+
+unsigned int SlotMask::Count() const {
+    unsigned int count = 0;
+
+    for(auto it: words)
+        count += __builtin_popcountll(it);
+
+    return count;
+}
+
+SlotIndex SlotMask::FindNext(SlotIndex pos) const {
+
+    if(pos >= numSlots)
+        return Def::Max_UnInt;
+
+    unsigned int wordIndex = pos / wordSize;
+    Word auxWord = words[wordIndex] & (~Word(0) << (pos % wordSize));
+
+    while(auxWord == 0){
+        if(++wordIndex == words.size())
+            return Def::Max_UnInt;
+        auxWord = words[wordIndex];
+    }
+
+    return wordIndex * wordSize + __builtin_ctzll(auxWord);
+}
+
+unsigned int SlotMask::CountSetBefore(SlotIndex pos) const {
+    this->CheckSlot(pos, "SlotMask::CountSetBefore");
+    
+    if(pos == 0)
+        return 0;
+    
+    unsigned int wordIndex = (pos - 1) / wordSize;
+    unsigned int numBits = (pos - 1) % wordSize + 1;
+    //The bits above pos-1 are shifted out and the inverted word has
+    //ones in the lowest positions, that stop the count.
+    Word auxWord = ~(words[wordIndex] << (wordSize - numBits));
+    
+    if(auxWord != 0 && __builtin_clzll(auxWord) < (int) numBits)
+        return __builtin_clzll(auxWord);
+    
+    unsigned int count = numBits;
+    
+    while(wordIndex-- > 0){
+        if(words[wordIndex] != ~Word(0))
+            return count + __builtin_clzll(~words[wordIndex]);
+        count += wordSize;
+    }
+    
+    return count;
+}
+
+unsigned int SlotMask::CountSetAfter(SlotIndex pos) const {
+    this->CheckSlot(pos, "SlotMask::CountSetAfter");
+    
+    if(pos + 1 == numSlots)
+        return 0;
+    
+    unsigned int wordIndex = (pos + 1) / wordSize;
+    unsigned int numBits = wordSize - (pos + 1) % wordSize;
+    //The unused bits of the last word are zero, so the count never goes
+    //beyond the last slot.
+    Word auxWord = ~(words[wordIndex] >> (wordSize - numBits));
+    
+    if(auxWord != 0 && __builtin_ctzll(auxWord) < (int) numBits)
+        return __builtin_ctzll(auxWord);
+    
+    unsigned int count = numBits;
+    
+    while(++wordIndex < words.size()){
+        if(words[wordIndex] != ~Word(0))
+            return count + __builtin_ctzll(~words[wordIndex]);
+        count += wordSize;
+    }
+    
+    return count;
+}
+
+SlotMask SlotMask::GetBlocksStart(unsigned int blockSize) const {
+    SlotMask blocks(*this);
+    SlotMask auxMask(0, false);
+    unsigned int length = 1;
+    unsigned int shift;
+
+    if(blockSize == 0 || blockSize > numSlots){
+        blocks.Assign(false);
+        return blocks;
+    }
+
+    //Each iteration extends the blocks represented by the set bits, so that
+    //a bit remains set only if the next 'length' slots are also set.
+    while(length < blockSize){
+        shift = std::min(length, blockSize - length);
+        auxMask = blocks;
+        auxMask.ShiftDown(shift);
+        blocks &= auxMask;
+        length += shift;
+    }
+
+    return blocks;
+}
+
+SlotIndex SlotMask::FindFirstBlock(unsigned int blockSize) const {
+
+    if(blockSize == 0 || blockSize > numSlots)
+        return Def::Max_UnInt;
+
+    return this->GetBlocksStart(blockSize).FindNext(0);
+}
+
+unsigned int SlotMask::GetNumSlots() const {
+    return numSlots;
+}
+
+const std::vector<SlotMask::Word>& SlotMask::GetWords() const {
+    return words;
+}
+
+void SlotMask::CheckSlot(SlotIndex pos, const char* function) const {
+
+    if(pos >= numSlots)
+        throw std::out_of_range(std::string(function) + ": slot " + 
+        std::to_string(pos) + " >= number of slots " + 
+        std::to_string(numSlots));
+}
+
+void SlotMask::ShiftDown(unsigned int shift) {
+    unsigned int wordShift = shift / wordSize;
+    unsigned int bitShift = shift % wordSize;
+    unsigned int numWords = words.size();
+
+    for(unsigned int a = 0; a < numWords; a++){
+        Word low = (a + wordShift < numWords) ? words[a + wordShift] : 0;
+        Word high = (a + wordShift + 1 < numWords) ?
+                    words[a + wordShift + 1] : 0;
+
+        if(bitShift == 0)
+            words[a] = low;
+        else
+            words[a] = (low >> bitShift) | (high << (wordSize - bitShift));
+    }
+}
+
+void SlotMask::ClearUnusedBits() {
+
+    if(numSlots % wordSize != 0)
+        words.back() &= ~Word(0) >> (wordSize - numSlots % wordSize);
+}
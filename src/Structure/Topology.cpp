@@ -14,6 +14,7 @@
 #include "../../include/Structure/Topology.h"
 
 #include "../../include/SimulationType/SimulationType.h"
+#include "../../include/SimulationType/NetworkSnapshot.h"
 #include "../../include/Data/Options.h"
 #include "../../include/Data/Parameters.h"
 #include "../../include/Data/InputOutput.h"
@@ -23,6 +24,7 @@
 #include "../../include/ResourceAllocation/Signal.h"
 #include "../../include/Calls/Call.h"
 #include "../../include/Calls/CallDevices.h"
+#include "../../include/GeneralClasses/Profiler.h"
 
 std::ostream& operator<<(std::ostream& ostream, 
 const Topology* topology) {
@@ -51,7 +53,7 @@ const Topology* topology) {
 Topology::Topology(SimulationType* simulType) 
 :simulType(simulType), options(nullptr), vecNodes(0), vecLinks(0), numNodes(0), 
 numLinks(0), numSlots(0), numCores(0), maxLength(0.0), numRegenerators(0),
-numTransponders(0) {
+numTransponders(0), numSimultAloc(0) {
 
 }
 
@@ -182,6 +184,26 @@ void Topology::SetNumSlots(unsigned int numSlots) {
     this->numSlots = numSlots;
 }
 
+void Topology::SetNumSlotsTraffic(
+const std::vector<unsigned int>& numSlotsTraffic) {
+    this->numSimultAloc.assign(this->numSlots + 1, 0);
+    
+    for(unsigned int a = 1; a <= this->numSlots; a++){
+        for(auto it: numSlotsTraffic){
+            assert(it > 0);
+            this->numSimultAloc.at(a) += a / it;
+        }
+    }
+}
+
+unsigned int Topology::GetNumSimultAloc(unsigned int blockSize) const {
+    
+    if(blockSize < this->numSimultAloc.size())
+        return this->numSimultAloc[blockSize];
+    
+    return 0;
+}
+
 void Topology::InsertLink(std::shared_ptr<Link> link) {
     assert( this->vecLinks.at(link->GetOrigimNode() * this->GetNumNodes()
     + link->GetDestinationNode()) == nullptr );
@@ -214,6 +236,10 @@ void Topology::SetNumDevices(unsigned int numDevices, DeviceType type) {
             std::abort();
     }
     this->DistributeDevices(type);
+    
+    //The devices of the nodes are created again, so the saved network state
+    //no longer applies.
+    this->simulType->GetSnapshot()->Clear();
 }
 
 void Topology::SetMaxLength() {
@@ -387,8 +413,8 @@ bool Topology::IsValidLigthPath(CallDevices* call) {
 
 bool Topology::CheckInsertFreeRegenerators(CallDevices* call) {
     NodeDevices* auxNode;
-    std::vector<std::shared_ptr<Regenerator>> vecReg(0);
-    std::vector<std::shared_ptr<Regenerator>> auxVecReg(0);
+    std::vector<Regenerator*> vecReg(0);
+    std::vector<Regenerator*> auxVecReg(0);
     std::vector<Call*> calls = call->GetTranspSegments();
     
     for(unsigned int a = 0; a < calls.size()-1; a++){
@@ -417,8 +443,8 @@ bool Topology::CheckInsertFreeBVTs(CallDevices* call) {
     NodeDevices* deNode = dynamic_cast<NodeDevices*>(call->GetRoute()
                                                          ->GetDeNode());
     unsigned int numSlots = call->GetNumberSlots();
-    std::vector<std::shared_ptr<BVT>> vecBVT(0);
-    std::vector<std::shared_ptr<BVT>> auxVecBVT(0);
+    std::vector<BVT*> vecBVT(0);
+    std::vector<BVT*> auxVecBVT(0);
     
     if(orNode->isThereFreeBVT(numSlots) && deNode->isThereFreeBVT(numSlots)){
         auxVecBVT = orNode->GetBVTs(call);
@@ -458,6 +484,7 @@ unsigned int Topology::GetNumSlots(Route* route) const {
 }
 
 void Topology::Connect(Call* call) {
+    PROFILE_SCOPE(PhaseConnect);
     
     switch(options->GetDevicesOption()){
         case DevicesDisabled:
@@ -569,20 +596,20 @@ void Topology::ConnectWithDevices(Call* call) {
     }
 
     //Connect the regenerators
-    std::vector<std::shared_ptr<Regenerator>> vecReg = 
-    callDev->GetRegenerators();
+    std::vector<Regenerator*> vecReg = callDev->GetRegenerators();
     for(auto it: vecReg){
         it->SetRegeneratorOn();
     }
     
     //Connect the transponders
-    std::vector<std::shared_ptr<BVT>> vecBVTs = callDev->GetTransponders();
+    std::vector<BVT*> vecBVTs = callDev->GetTransponders();
     for(auto it: vecBVTs){
         it->ConnectSubCarriers(callDev);
     }
 }
 
 void Topology::Release(Call* call) {
+    PROFILE_SCOPE(PhaseRelease);
     
     switch(options->GetDevicesOption()){
         case DevicesDisabled:
@@ -632,14 +659,13 @@ void Topology::ReleaseWithDevices(Call* call) {
     }
     
     //Release the regenerators
-    std::vector<std::shared_ptr<Regenerator>> vecReg = 
-    callDev->GetRegenerators();
+    std::vector<Regenerator*> vecReg = callDev->GetRegenerators();
     for(auto it: vecReg){
         it->SetRegeneratorOff();
     }
     
     //Release the transponders
-    std::vector<std::shared_ptr<BVT>> vecBVTs = callDev->GetTransponders();
+    std::vector<BVT*> vecBVTs = callDev->GetTransponders();
     for(auto it: vecBVTs){
         it->ReleaseSubCarriers(callDev);
     }